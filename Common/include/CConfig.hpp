@@ -409,6 +409,7 @@ private:
   unsigned long InnerIter;          /*!< \brief Current inner iterations for multizone problems. */
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned short nUnst_AdjointCheckpoints; /*!< \brief Number of direct states stored in memory for the unsteady adjoint (0 to use restart files). */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
@@ -426,6 +427,7 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NK_ADProducts;          /*!< \brief Use forward mode AD instead of finite differences in the NK matrix-free products. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -624,6 +626,9 @@ private:
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_Sliced_ELL;                 /*!< \brief Use a sliced ELLPACK copy of the matrix in the products of small block systems. */
+  PREC_STORAGE Kind_Linear_Solver_Prec_Storage;  /*!< \brief Storage precision of the ILU factors and diagonal inverses. */
+  bool Linear_Solver_Level_Scheduling;           /*!< \brief Level-scheduled (exact) parallel triangular solves in ILU and LU_SGS. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
@@ -816,11 +821,27 @@ private:
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_Preproc_Profile,       /*!< \brief Write the time and memory of each preprocessing phase.  */
+  Partition_WallDist_Cache,  /*!< \brief Reuse the partitioning and wall distance of previous runs.  */
+  WallDistance_Distributed,  /*!< \brief Compute the wall distance without gathering the walls on all ranks.  */
+  Output_Async,              /*!< \brief Write output files in a background thread.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
+  RESTART_COMPRESSION Restart_Compression; /*!< \brief Compression of the binary restart files. */
+  su2double Restart_Compression_Tol;       /*!< \brief Relative tolerance of the lossy restart compression. */
+  bool Restart_Mmap;                       /*!< \brief Read binary restart files through a memory mapping. */
+  string Preproc_Profile_FileName;         /*!< \brief JSON file for the preprocessing profile. */
+  string Partition_WallDist_Cache_FileName; /*!< \brief Base name of the partitioning and wall distance cache files. */
+  EXTRACT_KIND Kind_Extract;               /*!< \brief Selection of the elements of the extract output files. */
+  su2double Extract_Box[6];                /*!< \brief Min and max corner of the extraction box. */
+  su2double Extract_Plane[6];              /*!< \brief Point and normal of the extraction plane. */
+  string Extract_IsoField;                 /*!< \brief Volume output field of the extraction iso-surface. */
+  su2double Extract_IsoValue;              /*!< \brief Value of the extraction iso-surface. */
+  string *Extract_Fields;                  /*!< \brief Volume output fields (or groups) of the extract output files. */
+  unsigned short nExtract_Fields;          /*!< \brief Number of fields in EXTRACT_FIELDS. */
   unsigned short
   Console_Output_Verb,  /*!< \brief Level of verbosity for console output */
   Kind_Average;         /*!< \brief Particular average for the marker analyze. */
@@ -1179,6 +1200,10 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  POINT_ORDERING Kind_Point_Ordering; /*!< \brief Renumbering of the points after partitioning. */
+  EDGE_ORDERING Kind_Edge_Ordering; /*!< \brief Numbering of the edges used by the edge loops. */
+  unsigned long edgeOrderingBlockSize; /*!< \brief Number of points per block for the blocked edge ordering. */
+  bool edgeOrderingBenchmark;       /*!< \brief Time a model edge loop before and after renumbering the edges. */
   bool edgeColoringRelaxDiscAdj;    /*!< \brief Allow fallback to smaller edge color group sizes and use more colors for the discrete adjoint. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
@@ -3152,6 +3177,12 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the number of direct states that the unsteady adjoint stores in memory to recompute the direct solution.
+   * \return Number of checkpoints, 0 if the direct solution is loaded from restart files.
+   */
+  unsigned short GetnUnst_AdjointCheckpoints(void) const { return nUnst_AdjointCheckpoints; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3236,6 +3267,87 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get whether the time and memory of each preprocessing phase are written.
+   */
+  bool GetWrt_Preproc_Profile(void) const { return Wrt_Preproc_Profile; }
+
+  /*!
+   * \brief Get the name of the JSON file for the preprocessing profile (empty if not written).
+   */
+  const string& GetPreproc_Profile_FileName(void) const { return Preproc_Profile_FileName; }
+
+  /*!
+   * \brief Get whether the graph partitioning and wall distance are cached between runs.
+   */
+  bool GetPartition_WallDist_Cache(void) const { return Partition_WallDist_Cache; }
+
+  /*!
+   * \brief Get the base name of the partitioning and wall distance cache files.
+   */
+  const string& GetPartition_WallDist_Cache_FileName(void) const { return Partition_WallDist_Cache_FileName; }
+
+  /*!
+   * \brief Get whether the wall distance is computed with the walls distributed over the ranks.
+   */
+  bool GetWallDistance_Distributed(void) const { return WallDistance_Distributed; }
+
+  /*!
+   * \brief Get information about writing output files in the background.
+   * \return <code>TRUE</code> means that the solver continues while the output files are written.
+   */
+  bool GetOutput_Async(void) const { return Output_Async; }
+
+  /*!
+   * \brief Get the kind of compression of the binary restart files.
+   */
+  RESTART_COMPRESSION GetRestart_Compression(void) const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the relative tolerance for the fields that are compressed lossily in the restart files.
+   */
+  su2double GetRestart_Compression_Tol(void) const { return Restart_Compression_Tol; }
+
+  /*!
+   * \brief Get whether binary restart files are read through a memory mapping.
+   */
+  bool GetRestart_Mmap(void) const { return Restart_Mmap; }
+
+  /*!
+   * \brief Get the kind of selection of the elements written to the extract output files.
+   */
+  EXTRACT_KIND GetKind_Extract(void) const { return Kind_Extract; }
+
+  /*!
+   * \brief Get the extraction box (xmin, ymin, zmin, xmax, ymax, zmax).
+   */
+  const su2double* GetExtract_Box(void) const { return Extract_Box; }
+
+  /*!
+   * \brief Get the extraction plane (point and normal).
+   */
+  const su2double* GetExtract_Plane(void) const { return Extract_Plane; }
+
+  /*!
+   * \brief Get the volume output field that defines the extraction iso-surface.
+   */
+  const string& GetExtract_IsoField(void) const { return Extract_IsoField; }
+
+  /*!
+   * \brief Get the value of the extraction iso-surface.
+   */
+  su2double GetExtract_IsoValue(void) const { return Extract_IsoValue; }
+
+  /*!
+   * \brief Get the number of volume output fields (or groups) written to the extract output files.
+   */
+  unsigned short GetnExtract_Fields(void) const { return nExtract_Fields; }
+
+  /*!
+   * \brief Get the volume output fields (or groups) written to the extract output files.
+   */
+  const string* GetExtract_Fields(void) const { return Extract_Fields; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -4275,6 +4387,11 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether the Newton-Krylov matrix-free products use forward mode AD (exact) instead of finite differences.
+   */
+  bool GetNewtonKrylovADProducts(void) const { return NK_ADProducts; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -9662,11 +9779,50 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get whether to use a sliced ELLPACK (SELL-C-sigma) copy of the matrix in the matrix-vector products
+   *        of systems with 1 or 2 variables, the preconditioners use the CSR format.
+   * \return True if the sliced format should be used.
+   */
+  bool GetLinear_Solver_Sliced_ELL(void) const { return Linear_Solver_Sliced_ELL; }
+
+  /*!
+   * \brief Get the storage precision of the factors applied by the ILU and Jacobi preconditioners.
+   * \return Storage precision.
+   */
+  PREC_STORAGE GetKind_Linear_Solver_Prec_Storage(void) const { return Kind_Linear_Solver_Prec_Storage; }
+
+  /*!
+   * \brief Get whether the triangular solves of ILU and LU_SGS are parallelized by level scheduling.
+   * \return True for level scheduling, false for the partitioned (additive) approach.
+   */
+  bool GetLinear_Solver_Level_Scheduling(void) const { return Linear_Solver_Level_Scheduling; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get the renumbering of the points applied after partitioning.
+   */
+  POINT_ORDERING GetKind_Point_Ordering(void) const { return Kind_Point_Ordering; }
+
+  /*!
+   * \brief Get the numbering of the edges used by the edge loops.
+   */
+  EDGE_ORDERING GetKind_Edge_Ordering(void) const { return Kind_Edge_Ordering; }
+
+  /*!
+   * \brief Get the number of points per block for the blocked edge ordering.
+   */
+  unsigned long GetEdgeOrderingBlockSize(void) const { return edgeOrderingBlockSize; }
+
+  /*!
+   * \brief Get whether a model edge loop is timed before and after renumbering the edges.
+   */
+  bool GetEdgeOrderingBenchmark(void) const { return edgeOrderingBenchmark; }
+
   /*!
    * \brief Check if the discrete adjoint is allowed to relax the coloring, that is, allow smaller edge color group sizes and allow more colors.
    */
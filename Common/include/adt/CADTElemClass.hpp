@@ -122,7 +122,37 @@ class CADTElemClass : public CADTBaseClass {
                                  markerID, elemID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest element for a set of coordinates when each rank
+            only stores its own elements (the tree was built with globalTree = false).
+   * \details The local tree is searched first, this gives an upper bound for the distance. The
+              coordinates are then only sent to the ranks whose bounding box is closer than this
+              bound, first to one rank (given by rankHint or the one with the closest box), and
+              then to the remaining ones that are still closer than the improved bound. The result
+              is the same as with a global tree. This is a collective operation.
+   * \param[in]  nPoints  Number of coordinates.
+   * \param[in]  coor     Coordinates (nDim per point).
+   * \param[in]  rankHint Optional (can be null), rank that is likely to hold the nearest element of each
+                         point, e.g. from a previous search, values outside [0, size) are ignored.
+   * \param[out] dist     Distance to the nearest element (numerical limit if there are no elements).
+   * \param[out] markerID Local marker ID of the nearest element.
+   * \param[out] elemID   Local element ID of the nearest element.
+   * \param[out] rankID   Rank on which the nearest element is stored (-1 if there are no elements).
+   */
+  void DetermineNearestElementDistributed(unsigned long nPoints, const su2double* coor, const int* rankHint,
+                                          su2double* dist, unsigned short* markerID, unsigned long* elemID,
+                                          int* rankID);
+
  private:
+  /*!
+   * \brief Send the coordinates of some points to other ranks, search their trees, and keep the
+            results that are closer than the current ones (part of DetermineNearestElementDistributed).
+   * \param[in] requests - Indices of the points to send to each rank.
+   */
+  void ExchangeNearestElementQueries(const vector<vector<unsigned long> >& requests, const su2double* coor,
+                                     su2double* dist, unsigned short* markerID, unsigned long* elemID,
+                                     int* rankID);
+
   /*!
    * \brief Implementation of DetermineContainingElement.
    * \note Working variables (first two) passed explicitly for thread safety.
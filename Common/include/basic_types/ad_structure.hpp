@@ -30,6 +30,8 @@
 #include "../code_config.hpp"
 #include "../parallelization/omp_structure.hpp"
 
+#include <string>
+
 /*!
  * \namespace AD
  * \brief Contains routines for the reverse mode of AD.
@@ -606,6 +608,47 @@ FORCEINLINE void ResumePreaccumulation(bool wasActive) {
 void Initialize();
 void Finalize();
 
+/*!
+ * \brief Clear the tape memory statistics per phase of the recording.
+ * \param[in] active - Whether the phases of the next recording are measured.
+ */
+void ResetTapePhases(bool active);
+
+/*!
+ * \brief Start measuring the tape memory used by a phase of the recording, phases with the same name are accumulated.
+ * \note Only the master thread measures (its own tape in hybrid parallel AD), phases nested in other phases are ignored.
+ * \param[in] group - Name of the group of the phase (e.g. the name of the solver).
+ * \param[in] phase - Name of the phase.
+ */
+void StartTapePhase(const std::string& group, const char* phase);
+
+/*!
+ * \brief Stop measuring the current phase of the recording.
+ */
+void EndTapePhase();
+
+/*!
+ * \brief Start measuring the wall time of a tape evaluation (if the phases of the recording are measured).
+ */
+void StartEvaluationTimer();
+
+/*!
+ * \brief Stop measuring the wall time of a tape evaluation.
+ */
+void StopEvaluationTimer();
+
+/*!
+ * \brief Print the tape memory of each phase of the last recording, summed over all ranks,
+ * and the wall time of the recording (collective).
+ */
+void PrintTapePhases();
+
+/*!
+ * \brief Print the average wall time of the tape evaluations since the last recording or call,
+ * to compare runs with different numbers of threads per rank (collective).
+ */
+void PrintEvaluationTimes();
+
 }  // namespace AD
 
 /*--- If we compile under OSX we have to overload some of the operators for
@@ -1164,9 +1164,10 @@ class CMeshFEM_DG : public CMeshFEM {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Whether the walls of all ranks are gathered, otherwise the ADT only has the local walls.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const override;
 
   /*!
    * \brief Set wall distances a specific value
@@ -701,6 +701,12 @@ class CGeometry {
    */
   inline virtual void SetRCM_Ordering(CConfig* config) {}
 
+  /*!
+   * \brief Renumbers the points and elements along a space-filling curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetSFC_Ordering(CConfig* config) {}
+
   /*!
    * \brief Connects elements  .
    */
@@ -711,6 +717,14 @@ class CGeometry {
    */
   void SetEdges();
 
+  /*!
+   * \brief Renumber the edges to improve the locality of the edge loops (see EDGE_ORDERING).
+   * \note Must be called after SetEdges, before the edge colorings and edge-based maps are built.
+   *       The benchmark output refers to the multigrid level, which must be set before (SetMGLevel).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeOrdering(const CConfig* config);
+
   /*!
    * \brief Sets the faces of an element..
    */
@@ -1776,9 +1790,12 @@ class CGeometry {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Whether the walls of all ranks are gathered, otherwise the ADT only has the local walls.
    * \return pointer to the ADT
    */
-  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const { return nullptr; }
+  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const {
+    return nullptr;
+  }
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -1791,6 +1808,13 @@ class CGeometry {
   virtual void SetWallDistance(CADTElemClass* WallADT, const CConfig* config,
                                unsigned short iZone = numeric_limits<unsigned short>::max()) {}
 
+  /*!
+   * \brief Reduce the wall distance based on ADTs that only contain the walls of each rank (collective).
+   * \param[in] WallADT - Local ADT of the walls of zone iZone, see CADTElemClass::DetermineNearestElementDistributed.
+   * \param[in] iZone - Zone whose markers made the ADT
+   */
+  virtual void SetWallDistanceDistributed(CADTElemClass* WallADT, unsigned short iZone) {}
+
   /*!
    * \brief Set wall distances a specific value
    *  \param[in] val - new value for the wall distance at all points.
@@ -1801,8 +1825,10 @@ class CGeometry {
    * \brief Compute the distances to the closest vertex on viscous walls over the entire domain
    * \param[in] config_container - Definition of the particular problem.
    * \param[in] geometry_container - Geometrical definition of the problem.
+   * \param[in] allowCache - Whether the distances can be read from (or stored in) the cache (PARTITION_WALLDIST_CACHE).
    */
-  static void ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container);
+  static void ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container,
+                                  bool allowCache = false);
 
   /*!
    * \brief Set the amount of nonconvex elements in the mesh.
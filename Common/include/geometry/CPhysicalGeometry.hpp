@@ -90,6 +90,13 @@ class CPhysicalGeometry final : public CGeometry {
       0}; /*!< \brief Coordinates of the reference node [m] on the receiving periodic marker, for recovered
              pressure/temperature computation only.*/
 
+  /*!
+   * \brief Apply a renumbering of the points, common to the RCM and space-filling curve orderings.
+   * \param[in] Result - New to old point index, halo points must remain at the end.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPoint_Ordering(const vector<unsigned long>& Result, const CConfig* config);
+
  public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetBoundControlVolume;
@@ -362,6 +369,12 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetRCM_Ordering(CConfig* config) override;
 
+  /*!
+   * \brief Set a renumbering of the points and elements along a space-filling curve (Hilbert or Morton).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSFC_Ordering(CConfig* config) override;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -738,9 +751,10 @@ class CPhysicalGeometry final : public CGeometry {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Whether the walls of all ranks are gathered, otherwise the ADT only has the local walls.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const override;
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -752,6 +766,15 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetWallDistance(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) override;
 
+  /*!
+   * \brief Reduce the wall distance based on ADTs that only contain the walls of each rank (collective).
+   * \details The rank that held the closest wall element of zone iZone in the previous computation
+   * (e.g. before the mesh was deformed) is searched first, since it most likely still holds it.
+   * \param[in] WallADT - Local ADT of the walls of zone iZone.
+   * \param[in] iZone - Zone whose markers made the ADT
+   */
+  void SetWallDistanceDistributed(CADTElemClass* WallADT, unsigned short iZone) override;
+
   /*!
    * \brief Set wall distances a specific value
    */
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../../containers/C2DContainer.hpp"
 
 class CPhysicalGeometry;
@@ -104,6 +106,12 @@ class CEdge {
     Nodes(iEdge, RIGHT) = jPoint;
   }
 
+  /*!
+   * \brief Renumber the edges, the nodes and normals of edge "newToOld[iEdge]" become those of edge "iEdge".
+   * \param[in] newToOld - Permutation of the edges, size nEdge.
+   */
+  void Renumber(const std::vector<unsigned long>& newToOld);
+
   /*!
    * \brief Get the number of nodes of an edge (2).
    */
@@ -486,6 +486,22 @@ class CPoint {
   }
   inline void SetWall_Distance(unsigned long iPoint, su2double distance) { Wall_Distance(iPoint) = distance; }
 
+  /*!
+   * \brief Get the closest wall element of a point (see SetWall_Distance).
+   * \param[in] iPoint - Index of the point.
+   * \param[out] rankID - Rank of process holding the closest wall element.
+   * \param[out] zoneID - Zone index of closest wall element.
+   * \param[out] markerID - Marker index of closest wall element.
+   * \param[out] elemID - Element index of closest wall element.
+   */
+  inline void GetClosestWall(unsigned long iPoint, int& rankID, unsigned short& zoneID, unsigned short& markerID,
+                             unsigned long& elemID) const {
+    rankID = ClosestWall_Rank(iPoint);
+    zoneID = ClosestWall_Zone(iPoint);
+    markerID = ClosestWall_Marker(iPoint);
+    elemID = ClosestWall_Elem(iPoint);
+  }
+
   /*!
    * \brief Get the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -30,6 +30,10 @@
 
 #ifdef HAVE_CGNS
 #include "cgnslib.h"
+#if defined(HAVE_MPI) && CG_BUILD_PARALLEL
+#include "pcgnslib.h"
+#define SU2_CGNS_PARALLEL
+#endif
 #endif
 
 #include "CMeshReaderFVM.hpp"
@@ -45,6 +49,7 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
   int cgnsFileID;         /*!< \brief CGNS file identifier. */
   const int cgnsBase = 1; /*!< \brief CGNS database index (the CGNS reader currently assumes a single database). */
   const int cgnsZone = 1; /*!< \brief CGNS zone index (and 1 zone in that database). */
+  bool parallelIO = false; /*!< \brief Whether the file is read with collective (parallel HDF5) hyperslab reads. */
 
   int nSections; /*!< \brief Total number of sections in the CGNS file. */
 
@@ -65,6 +70,14 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
    */
   void OpenCGNSFile(const string& val_filename);
 
+  /*!
+   * \brief Check whether a file can be read with the parallel CGNS API, i.e. if it is an HDF5 file whose sections all
+   * have a fixed element size (no MIXED, NGON_n, or NFACE_n sections). The master rank checks and broadcasts.
+   * \param[in] val_filename - string name of the CGNS file to be read.
+   * \param[in] file_type - CGNS file type returned by cg_is_cgns.
+   */
+  bool CanReadInParallel(const string& val_filename, int file_type) const;
+
   /*!
    * \brief Reads all CGNS database metadata and checks for errors.
    */
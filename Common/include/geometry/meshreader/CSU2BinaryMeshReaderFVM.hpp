@@ -0,0 +1,114 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \brief Layout of the native SU2 binary mesh format (single zone, native byte order).
+ * \note The file starts with the magic string and the header (HEADER_SIZE int64), followed by:
+ *       - Points: NPOIN x NDIME doubles (point-major), the global index of a point is its position.
+ *       - Element index: NELEM+1 int64 offsets (number of int64 from the start of the connectivity).
+ *       - Element connectivity: VTK type and nodes (int64) of each element, contiguous.
+ *       - Markers: for each marker, the number of elements, the length of the tag, the tag (chars,
+ *         no terminator), and the VTK type and nodes (int64) of each element.
+ *       The offsets in the header are in bytes from the start of the file.
+ */
+namespace SU2BinaryMesh {
+constexpr char magic[] = "SU2MESHB";
+constexpr unsigned long magicSize = 8;
+
+enum HeaderEntry : unsigned long {
+  NDIME,             /*!< \brief Dimension of the problem. */
+  NPOIN,             /*!< \brief Number of points. */
+  NELEM,             /*!< \brief Number of volume elements. */
+  NMARK,             /*!< \brief Number of markers. */
+  POINTS_OFFSET,     /*!< \brief Offset of the point coordinates. */
+  ELEM_INDEX_OFFSET, /*!< \brief Offset of the element index. */
+  ELEM_CONN_OFFSET,  /*!< \brief Offset of the element connectivity. */
+  MARKERS_OFFSET,    /*!< \brief Offset of the markers. */
+  MARKERS_SIZE,      /*!< \brief Size of the marker section in bytes. */
+  HEADER_SIZE
+};
+}  // namespace SU2BinaryMesh
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note Each rank reads only its slice of the points and elements (collective MPI I/O), the
+ *       elements are then sent to all ranks that own one of their points.
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief File handle for the SU2 binary mesh file. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief File handle for the SU2 binary mesh file. */
+#endif
+
+  int64_t header[SU2BinaryMesh::HEADER_SIZE] = {0}; /*!< \brief Header of the file. */
+
+  /*!
+   * \brief Collectively read a block of the file, each rank reads its own offset and size.
+   * \param[in] offset - Offset in bytes from the start of the file.
+   * \param[out] data - Where to read into.
+   * \param[in] sizeInBytes - Number of bytes to read on this rank (can be 0).
+   */
+  void ReadAll(unsigned long offset, void* data, unsigned long sizeInBytes);
+
+  /*!
+   * \brief Reads the magic string and the header (master reads, then broadcast) and checks for errors.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of this rank's linear partition.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and distributes it to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements, the master reads them and broadcasts to all ranks.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+};
@@ -0,0 +1,156 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Aggregation-based algebraic multigrid hierarchy for block-sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+class CConfig;
+class CGeometry;
+template <class T>
+class CSysMatrix;
+template <class T>
+class CSysVector;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Aggregation-based algebraic multigrid (AMG) used as a preconditioner for CSysMatrix.
+ *
+ * The coarse levels are built directly from the block-CSR storage of the matrix, points are
+ * grouped into aggregates based on the strength of the block couplings, and the coarse operators
+ * are the Galerkin products with a piecewise constant (block identity) prolongation. Aggregation
+ * is local to each rank (couplings to halo points are dropped on coarse levels), which keeps the
+ * setup and the coarse corrections free of communication. The finest level is smoothed with
+ * damped block-Jacobi, including the couplings to other ranks. The cycle is a symmetric V-cycle.
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  enum : unsigned long { MAX_LEVELS = 10 };        /*!< \brief Maximum number of coarse levels. */
+  enum : unsigned long { MIN_COARSE_POINTS = 64 }; /*!< \brief Coarsening stops below this number of points. */
+  enum : unsigned long { COARSEST_SWEEPS = 8 };    /*!< \brief Gauss-Seidel sweeps used on the coarsest level. */
+
+  /*!
+   * \brief Data of one coarse level.
+   */
+  struct CLevel {
+    unsigned long nPoint = 0;            /*!< \brief Number of (coarse) points. */
+    std::vector<unsigned long> row_ptr;  /*!< \brief Pointers to the first element in each row. */
+    std::vector<unsigned long> col_ind;  /*!< \brief Column index for each of the blocks. */
+    std::vector<unsigned long> dia_ptr;  /*!< \brief Pointers to the diagonal block in each row. */
+    std::vector<ScalarType> matrix;      /*!< \brief Blocks of the coarse (Galerkin) operator. */
+    std::vector<ScalarType> invDiag;     /*!< \brief Inverse of the diagonal blocks (for the smoother). */
+    std::vector<unsigned long> agg_ptr;  /*!< \brief Pointers to the first finer point of each aggregate. */
+    std::vector<unsigned long> agg_idx;  /*!< \brief Finer level points that form each aggregate. */
+    mutable std::vector<ScalarType> sol; /*!< \brief Correction on this level (working memory). */
+    mutable std::vector<ScalarType> rhs; /*!< \brief Restricted residual (working memory). */
+    mutable std::vector<ScalarType> res; /*!< \brief Residual of the smoother (working memory). */
+  };
+
+  std::vector<CLevel> levels; /*!< \brief Coarse levels, the finest level is the CSysMatrix itself. */
+
+  mutable std::vector<ScalarType> fineRes; /*!< \brief Residual on the finest level (working memory). */
+
+  /*!
+   * \brief Group the points of a block-CSR matrix into aggregates.
+   * \param[in] nPoint - Number of rows, columns beyond this are ignored (e.g. halos).
+   * \param[in] nVar - Block size.
+   * \param[in] row_ptr - Row pointers.
+   * \param[in] col_ind - Column indices.
+   * \param[in] dia_ptr - Pointers to the diagonal blocks.
+   * \param[in] values - Blocks of the matrix.
+   * \param[out] aggregate - Aggregate of each point.
+   * \return Number of aggregates.
+   */
+  static unsigned long Aggregate(unsigned long nPoint, unsigned long nVar, const unsigned long* row_ptr,
+                                 const unsigned long* col_ind, const unsigned long* dia_ptr,
+                                 const ScalarType* values, std::vector<unsigned long>& aggregate);
+
+  /*!
+   * \brief Build a coarse level (pattern, Galerkin operator, smoother) from a finer block-CSR matrix.
+   * \param[in] fine - The finest matrix, provides the dense block operations.
+   * \param[in] nPoint - Number of rows of the finer matrix.
+   * \param[in] row_ptr - Row pointers of the finer matrix.
+   * \param[in] col_ind - Column indices of the finer matrix.
+   * \param[in] dia_ptr - Pointers to the diagonal blocks of the finer matrix.
+   * \param[in] values - Blocks of the finer matrix.
+   * \param[out] coarse - The new level.
+   * \return False if coarsening is not effective, in which case the level should be discarded.
+   */
+  static bool Coarsen(const CSysMatrix<ScalarType>& fine, unsigned long nPoint, const unsigned long* row_ptr,
+                      const unsigned long* col_ind, const unsigned long* dia_ptr, const ScalarType* values,
+                      CLevel& coarse);
+
+  /*!
+   * \brief Damped block-Jacobi sweep on a coarse level, sol += omega * D^-1 * (rhs - A * sol).
+   * \param[in] fine - The finest matrix, provides the dense block operations.
+   * \param[in] level - The level being smoothed.
+   * \param[in] zeroGuess - Assume sol = 0, saves the residual computation.
+   */
+  void SmoothJacobi(const CSysMatrix<ScalarType>& fine, const CLevel& level, bool zeroGuess) const;
+
+  /*!
+   * \brief Symmetric block Gauss-Seidel sweeps used on the coarsest level.
+   * \param[in] fine - The finest matrix, provides the dense block operations.
+   * \param[in] level - The coarsest level.
+   */
+  void SolveCoarsest(const CSysMatrix<ScalarType>& fine, const CLevel& level) const;
+
+  /*!
+   * \brief Recursive V-cycle starting at a coarse level (the rhs of the level must be set).
+   * \param[in] fine - The finest matrix, provides the dense block operations.
+   * \param[in] iLevel - Index of the level.
+   */
+  void Cycle(const CSysMatrix<ScalarType>& fine, unsigned long iLevel) const;
+
+ public:
+  /*!
+   * \brief Build (or rebuild) the hierarchy from the current values of the matrix.
+   * \note Only one thread should call this method, the inverse diagonal blocks of the finest
+   *       level must have been computed by the matrix (see BuildJacobiPreconditioner).
+   * \param[in] fine - The finest matrix.
+   */
+  void Build(const CSysMatrix<ScalarType>& fine);
+
+  /*!
+   * \brief Apply one V-cycle to vec, starting from a zero initial guess, storing the result in prod.
+   * \note This method is thread-safe (all threads of the team must call it).
+   * \param[in] fine - The finest matrix.
+   * \param[in] vec - Vector being preconditioned.
+   * \param[out] prod - Result of the preconditioning.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Apply(const CSysMatrix<ScalarType>& fine, const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+             CGeometry* geometry, const CConfig* config) const;
+
+  /*!
+   * \brief Get the number of coarse levels of the hierarchy.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+};
@@ -31,6 +31,8 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
+#include "half_precision.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -116,6 +118,7 @@ template <class ScalarType>
 class CSysMatrix {
  private:
   friend struct CSysMatrixComms;
+  friend class CAlgebraicMultigrid<ScalarType>;
 
   const int rank; /*!< \brief MPI Rank. */
   const int size; /*!< \brief MPI Size. */
@@ -154,6 +157,35 @@ class CSysMatrix {
 
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  PREC_STORAGE prec_storage = PREC_STORAGE::FULL; /*!< \brief Precision of the factors applied by ILU and Jacobi. */
+  uint16_t* ILU_half = nullptr;                   /*!< \brief 16 bit copy of ILU_matrix (if prec_storage != FULL). */
+  uint16_t* invM_half = nullptr;                  /*!< \brief 16 bit copy of invM (if prec_storage != FULL). */
+  mutable unsigned long half_clamped = 0;         /*!< \brief Factors of this rank clamped to the FP16 range. */
+  mutable bool half_clamp_warned = false;         /*!< \brief Whether the clamping to the FP16 range was reported. */
+
+  /*!
+   * \brief Access to the blocks of a preconditioner stored in the precision of the matrix.
+   */
+  struct CFullBlocks {
+    const ScalarType* data;
+    unsigned long blkSz;
+    FORCEINLINE const ScalarType* operator()(unsigned long iBlk, ScalarType*) const { return &data[iBlk * blkSz]; }
+  };
+
+  /*!
+   * \brief Access to the blocks of a preconditioner stored in 16 bits, the blocks are decoded to a buffer.
+   */
+  template <class Format>
+  struct CHalfBlocks {
+    const uint16_t* data;
+    unsigned long blkSz;
+    FORCEINLINE const ScalarType* operator()(unsigned long iBlk, ScalarType* buf) const {
+      const uint16_t* blk = &data[iBlk * blkSz];
+      for (auto i = 0ul; i < blkSz; ++i) buf[i] = Format::Decode(blk[i]);
+      return buf;
+    }
+  };
+
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
   mutable vector<vector<const ScalarType*> >
       LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
@@ -179,6 +211,32 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg; /*!< \brief Hierarchy of the AMG preconditioner. */
+
+  /*--- Sliced ELLPACK (SELL-C-sigma) copy of the matrix, used in matrix-vector products of small blocks.
+   * Slices of SELL_C rows are stored column by column, and for each column the block entries are stored
+   * entry by entry (structure of arrays) such that the products of a slice map to SIMD lanes. ---*/
+  enum : unsigned long { SELL_MAXNVAR = 2 }; /*!< \brief Largest block size for which the sliced format is used. */
+  enum : unsigned long { SELL_C = simd::preferredLen<ScalarType>() }; /*!< \brief Rows per slice. */
+  enum : unsigned long { SELL_SIGMA = 8 }; /*!< \brief Slices per sorting window (sigma = SELL_SIGMA * SELL_C). */
+  bool sell_valid = false;                 /*!< \brief If the sliced copy is up to date and used in products. */
+  unsigned long omp_sell_size = 1;         /*!< \brief Chunk size used in loops over slices. */
+  vector<unsigned long> sell_ptr;          /*!< \brief Offset of each slice (in blocks). */
+  vector<unsigned long> sell_row;          /*!< \brief Row of each slot of the slices (sorted within windows). */
+  vector<unsigned long> sell_col;          /*!< \brief Column index of each block. */
+  vector<unsigned long> sell_map;          /*!< \brief Index of each block in the CSR storage (nnz for padding). */
+  ScalarType* sell_val = nullptr;          /*!< \brief Entries of the sliced matrix. */
+
+  /*!
+   * \brief Rows of a triangular solve grouped in levels, rows only depend on rows of previous levels.
+   */
+  struct CLevelSchedule {
+    vector<unsigned long> ptr;  /*!< \brief Pointers to the first row of each level. */
+    vector<unsigned long> rows; /*!< \brief Rows sorted by level. */
+  };
+  CLevelSchedule lower_levels; /*!< \brief Levels of the forward substitutions (and of the ILU factorization). */
+  CLevelSchedule upper_levels; /*!< \brief Levels of the backward substitutions. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -194,6 +252,37 @@ class CSysMatrix {
 
   } edge_ptr;
 
+  /*!
+   * \brief Build the pattern of the sliced ELLPACK copy of the matrix.
+   */
+  void BuildSlicedPattern();
+
+  /*!
+   * \brief Group the rows of the preconditioner (ILU or LU_SGS) in levels for the parallel triangular solves.
+   * \param[in] row_ptr_prec - Row pointers of the preconditioner.
+   * \param[in] col_ind_prec - Column indices of the preconditioner.
+   * \param[in] dia_ptr_prec - Pointers to the diagonal blocks of the preconditioner.
+   */
+  void BuildLevelSchedule(const unsigned long* row_ptr_prec, const unsigned long* col_ind_prec,
+                          const unsigned long* dia_ptr_prec);
+
+  /*!
+   * \brief Apply a function to all rows, level by level, the rows of each level are divided among threads.
+   * \note This method is thread-safe (all threads of the team must call it).
+   * \param[in] levels - The level schedule.
+   * \param[in] rowFun - Function of the row index.
+   */
+  template <class RowFunction>
+  void LevelScheduledLoop(const CLevelSchedule& levels, const RowFunction& rowFun) const;
+
+  /*!
+   * \brief Matrix-vector product with the sliced ELLPACK copy of the matrix (domain rows only).
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   */
+  template <unsigned long nVar_>
+  void SlicedProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
   /*!
    * \brief Handle type conversion for when we Set, Add, etc. blocks, preserving derivative information (if supported by
    * types).
@@ -311,6 +400,34 @@ class CSysMatrix {
    */
   inline ScalarType* GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
 
+  /*!
+   * \brief Store a copy of the factors of a preconditioner in the 16 bit format given by prec_storage.
+   * \param[in] src - Factors (in the precision of the matrix).
+   * \param[in] size - Number of entries.
+   * \param[out] dst - 16 bit copy.
+   */
+  void CompressFactors(const ScalarType* src, unsigned long size, uint16_t* dst) const;
+
+  /*!
+   * \brief Forward and backward substitutions of the ILU preconditioner (thread-local, without communication).
+   * \param[in] LU - Accessor to the blocks of the ILU factors.
+   * \param[in] invD - Accessor to the inverse diagonal blocks.
+   * \param[in] vec - Vector to be preconditioned.
+   * \param[out] prod - Result of the preconditioning.
+   */
+  template <class Blocks>
+  void ILUSubstitutions(const Blocks& LU, const Blocks& invD, const CSysVector<ScalarType>& vec,
+                        CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Product by the inverse diagonal blocks of the Jacobi preconditioner (without communication).
+   * \param[in] invD - Accessor to the inverse diagonal blocks.
+   * \param[in] vec - Vector to be preconditioned.
+   * \param[out] prod - Result of the preconditioning.
+   */
+  template <class Blocks>
+  void JacobiProduct(const Blocks& invD, const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
   /*!
    * \brief Set the value of a block in the sparse matrix.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -828,6 +945,24 @@ class CSysMatrix {
    */
   void MatrixMatrixAddition(ScalarType alpha, const CSysMatrix& B);
 
+  /*!
+   * \brief Copy the values of the matrix to its sliced ELLPACK copy (if the format is enabled), after
+   *        this, and until InvalidateSlicedValues is called, the products use the sliced format.
+   * \note The matrix should not be modified while the sliced copy is in use.
+   */
+  void UpdateSlicedValues();
+
+  /*!
+   * \brief Stop using the sliced ELLPACK copy of the matrix in products, e.g. before the matrix is modified.
+   */
+  inline void InvalidateSlicedValues() {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    sell_valid = false;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
@@ -868,6 +1003,21 @@ class CSysMatrix {
   void ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                 const CConfig* config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner (also builds the Jacobi preconditioner used as smoother).
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one AMG V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
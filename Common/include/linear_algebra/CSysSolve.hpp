@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <string>
+#include <utility>
 
 #include "CSysVector.hpp"
 #include "../option_structure.hpp"
@@ -100,6 +101,13 @@ class CSysSolve {
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<VectorType> P; /*!< \brief Auxiliary vectors of the pipelined solvers. */
+
+  mutable std::vector<ScalarType> dotsLocal;  /*!< \brief Rank-local fused dot products (pipelined solvers). */
+  mutable std::vector<ScalarType> dotsGlobal; /*!< \brief Reduced fused dot products (pipelined solvers). */
+  mutable typename SelectMPIWrapper<ScalarType>::W::Request
+      dotsRequest; /*!< \brief Request of the non-blocking reduction of the fused dot products. */
+
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType
@@ -184,6 +192,26 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Start the reduction of several dot products, fused into one non-blocking message.
+   * \note All threads must call this method, and CompleteDots before the next call.
+   * \param[in] pairs - Pairs of vectors whose dot product is needed.
+   */
+  void StartDots(const std::vector<std::pair<const VectorType*, const VectorType*> >& pairs) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartDots.
+   * \param[out] dots - The dot products, in the order of the pairs given to StartDots.
+   */
+  void CompleteDots(ScalarType* dots) const;
+
+  /*!
+   * \brief Allocate the auxiliary vectors of the pipelined solvers.
+   * \param[in] n - Number of vectors.
+   * \param[in] x - Vector with the required size.
+   */
+  void AllocatePipelineVectors(unsigned long n, const VectorType& x) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -349,6 +377,48 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config) const;
 
+  /*!
+   * \brief Pipelined right-preconditioned GMRES (p1-GMRES).
+   * \note The global reduction of each iteration (all the Gram-Schmidt dot products are fused) is
+   *       overlapped with the next matrix-vector product and preconditioner, which are applied to the
+   *       non-orthogonalized vector and corrected afterwards. When the new vector is close to the
+   *       span of the basis a second Gram-Schmidt pass is done (one more reduction, not overlapped).
+   *       This is equivalent to FGMRES when the preconditioner is a fixed linear operator (which is
+   *       the case for those in CPreconditioner).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                  bool monitoring, const CConfig* config) const;
+
+  /*!
+   * \brief Pipelined Biconjugate Gradient Stabilized Method (p-BiCGStab, Cools and Vanroose).
+   * \note Two fused non-blocking reductions per iteration, each overlapped with one matrix-vector
+   *       product and preconditioner. The residual norm is part of the reductions so convergence is
+   *       checked regardless of the communication level. Right preconditioning is used, the
+   *       preconditioner must be a fixed linear operator.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PBCGSTAB_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                   bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -0,0 +1,142 @@
+/*!
+ * \file half_precision.hpp
+ * \brief Conversions between float and 16 bit storage formats (bfloat16 and IEEE half).
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#include "../code_config.hpp"
+
+/*!
+ * \namespace HalfPrecision
+ * \brief 16 bit floating point formats, used only for storage, all arithmetic is done in float (or wider).
+ * \note Both formats round to nearest even on encoding.
+ */
+namespace HalfPrecision {
+
+/*!
+ * \brief Reinterpret the bits of a float as an integer and vice-versa.
+ */
+FORCEINLINE uint32_t FloatBits(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+FORCEINLINE float BitsFloat(uint32_t bits) {
+  float value;
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+/*!
+ * \brief bfloat16, the upper half of a float (8 bit exponent, 7 bit mantissa).
+ * Same range as float, roughly 3 significant digits.
+ */
+struct BFloat16 {
+  static FORCEINLINE uint16_t Encode(float value) {
+    uint32_t bits = FloatBits(value);
+    /*--- Keep NaN quiet, the rounding could otherwise turn it into infinity. ---*/
+    if ((bits & 0x7fffffffu) > 0x7f800000u) return static_cast<uint16_t>((bits >> 16) | 0x40u);
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+  }
+
+  static FORCEINLINE float Decode(uint16_t value) { return BitsFloat(static_cast<uint32_t>(value) << 16); }
+};
+
+/*!
+ * \brief IEEE 754 binary16 (5 bit exponent, 10 bit mantissa).
+ * Roughly 3.3 significant digits for magnitudes in the normal range [6.1e-5, 65504], smaller
+ * values become subnormal (fewer digits, down to 6e-8) or zero, larger values become infinity.
+ */
+struct Float16 {
+  /*!
+   * \brief Largest finite value.
+   */
+  static constexpr float Max() { return 65504.0f; }
+
+  /*!
+   * \brief Encode, values beyond the finite range are clamped to +/-Max instead of becoming infinity.
+   */
+  static FORCEINLINE uint16_t EncodeSaturated(float value) {
+    /*--- NaN fails both comparisons and is encoded as such. ---*/
+    return Encode(value > Max() ? Max() : (value < -Max() ? -Max() : value));
+  }
+
+  static FORCEINLINE uint16_t Encode(float value) {
+#if defined(__F16C__)
+    return _cvtss_sh(value, 0);
+#else
+    const uint32_t bits = FloatBits(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t x = bits & 0x7fffffffu;
+
+    /*--- Infinity and NaN. ---*/
+    if (x >= 0x7f800000u) return sign | 0x7c00u | (x > 0x7f800000u ? 0x200u : 0u);
+    /*--- Overflow, from 65520 the value rounds to infinity. ---*/
+    if (x >= 0x477ff000u) return sign | 0x7c00u;
+    /*--- Underflow, below half of the smallest subnormal. ---*/
+    if (x < 0x33000000u) return sign;
+
+    if (x < 0x38800000u) {
+      /*--- Subnormal result, shift the mantissa (with the implicit bit) by the exponent difference. ---*/
+      const uint32_t mant = (x & 0x7fffffu) | 0x800000u;
+      const uint32_t shift = 126u - (x >> 23);
+      const uint32_t rem = mant & ((1u << shift) - 1u);
+      const uint32_t halfway = 1u << (shift - 1u);
+      uint32_t h = mant >> shift;
+      h += (rem > halfway) || (rem == halfway && (h & 1u));
+      return sign | static_cast<uint16_t>(h);
+    }
+
+    /*--- Normal result, re-bias the exponent (127-15) and round the mantissa, carries go into the exponent. ---*/
+    uint32_t h = (x >> 13) - (112u << 10);
+    const uint32_t rem = x & 0x1fffu;
+    h += (rem > 0x1000u) || (rem == 0x1000u && (h & 1u));
+    return sign | static_cast<uint16_t>(h);
+#endif
+  }
+
+  static FORCEINLINE float Decode(uint16_t value) {
+#if defined(__F16C__)
+    return _cvtsh_ss(value);
+#else
+    /*--- Place exponent and mantissa in the float positions and fix the bias with a product,
+     * which also handles subnormals. Infinity and NaN need the maximum float exponent. ---*/
+    const uint32_t x = static_cast<uint32_t>(value & 0x7fffu) << 13;
+    const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    if ((value & 0x7c00u) == 0x7c00u) return BitsFloat(sign | 0x7f800000u | x);
+    return BitsFloat(sign | FloatBits(BitsFloat(x) * 5.192296858534828e+33f));
+#endif
+  }
+};
+
+}  // namespace HalfPrecision
@@ -1989,16 +1989,18 @@ static const MapType<std::string, ENUM_OBJECTIVE> Objective_Map = {
  * \brief Types of input file formats
  */
 enum ENUM_INPUT {
-  SU2       = 1,  /*!< \brief SU2 input format. */
-  CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
-  RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2        = 1,  /*!< \brief SU2 input format. */
+  CGNS_GRID  = 2,  /*!< \brief CGNS input format for the computational grid. */
+  RECTANGLE  = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
+  BOX        = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5   /*!< \brief Native SU2 binary format, read in parallel with MPI I/O. */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 
@@ -2017,6 +2019,9 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
+  EXTRACT_PARAVIEW,        /*!< \brief Paraview XML format for the extracted part of the volume (see EXTRACT_KIND). */
+  EXTRACT_CSV,             /*!< \brief Comma-separated values format for the extracted part of the volume. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2042,6 +2047,9 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
+  MakePair("EXTRACT_PARAVIEW", OUTPUT_TYPE::EXTRACT_PARAVIEW)
+  MakePair("EXTRACT_CSV", OUTPUT_TYPE::EXTRACT_CSV)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
@@ -2083,6 +2091,44 @@ inline bool isTecplot(OUTPUT_TYPE format) {
   }
 }
 
+/*!
+ * \brief Return true if format writes only the extracted part of the volume.
+ */
+inline bool isExtract(OUTPUT_TYPE format) {
+  return format == OUTPUT_TYPE::EXTRACT_PARAVIEW || format == OUTPUT_TYPE::EXTRACT_CSV;
+}
+
+/*!
+ * \brief Selection of the volume elements written to the extract output files.
+ */
+enum class EXTRACT_KIND {
+  BOX,         /*!< \brief Elements with at least one point inside an axis-aligned box. */
+  SLICE,       /*!< \brief Elements cut by a plane. */
+  ISOSURFACE,  /*!< \brief Elements cut by an iso-surface of a volume output field. */
+};
+static const MapType<std::string, EXTRACT_KIND> Extract_Map = {
+  MakePair("BOX", EXTRACT_KIND::BOX)
+  MakePair("SLICE", EXTRACT_KIND::SLICE)
+  MakePair("ISOSURFACE", EXTRACT_KIND::ISOSURFACE)
+};
+
+/*!
+ * \brief Compression of the binary restart files.
+ */
+enum class RESTART_COMPRESSION {
+  NONE,      /*!< \brief Raw doubles. */
+  LOSSLESS,  /*!< \brief Block-compressed, all fields are recovered exactly. */
+  LOSSY,     /*!< \brief Block-compressed, fields that are not read on restart are rounded to a relative tolerance. */
+};
+static const MapType<std::string, RESTART_COMPRESSION> Restart_Compression_Map = {
+  MakePair("NONE", RESTART_COMPRESSION::NONE)
+  MakePair("LOSSLESS", RESTART_COMPRESSION::LOSSLESS)
+  MakePair("LOSSY", RESTART_COMPRESSION::LOSSY)
+};
+
+const int SU2_RESTART_MAGIC = 535532;             /*!< \brief First int of binary restart files (hex representation of "SU2"). */
+const int SU2_COMPRESSED_RESTART_MAGIC = 535533;  /*!< \brief First int of compressed binary restart files. */
+
 /*!
  * \brief Type of solution output file formats
  */
@@ -2230,6 +2276,8 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_FGMRES,     /*!< \brief Pipelined GMRES, reductions overlapped with products and preconditioning. */
+  PIPELINED_BCGSTAB,    /*!< \brief Pipelined BCGSTAB, reductions overlapped with products and preconditioning. */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
@@ -2239,6 +2287,8 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
 };
 
 /*!
@@ -2295,6 +2345,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2304,11 +2355,52 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
 };
 
+/*!
+ * \brief Storage precision of the factors applied by the linear solver preconditioners.
+ */
+enum class PREC_STORAGE {
+  FULL,  /*!< \brief Same precision as the matrix. */
+  BF16,  /*!< \brief bfloat16, range of float with a 7 bit mantissa. */
+  FP16,  /*!< \brief IEEE half precision, 10 bit mantissa with a limited range. */
+};
+static const MapType<std::string, PREC_STORAGE> Prec_Storage_Map = {
+  MakePair("FULL", PREC_STORAGE::FULL)
+  MakePair("BF16", PREC_STORAGE::BF16)
+  MakePair("FP16", PREC_STORAGE::FP16)
+};
+
+/*!
+ * \brief Renumbering of the points after partitioning.
+ */
+enum class POINT_ORDERING {
+  RCM,      /*!< \brief Reverse Cuthill-McKee, minimizes the bandwidth of the matrices (best for ILU). */
+  HILBERT,  /*!< \brief Hilbert curve through the coordinates, spatially compact data layout. */
+  MORTON,   /*!< \brief Morton (Z) curve through the coordinates, cheaper but less compact than Hilbert. */
+};
+static const MapType<std::string, POINT_ORDERING> Point_Ordering_Map = {
+  MakePair("RCM", POINT_ORDERING::RCM)
+  MakePair("HILBERT", POINT_ORDERING::HILBERT)
+  MakePair("MORTON", POINT_ORDERING::MORTON)
+};
+
+/*!
+ * \brief Numbering of the edges used by the edge loops.
+ */
+enum class EDGE_ORDERING {
+  NATURAL,  /*!< \brief Order in which the edges are found, i.e. sorted by their first node. */
+  BLOCKED,  /*!< \brief Edges grouped by blocks of points, the blocks are visited in Morton (Z) order. */
+};
+static const MapType<std::string, EDGE_ORDERING> Edge_Ordering_Map = {
+  MakePair("NATURAL", EDGE_ORDERING::NATURAL)
+  MakePair("BLOCKED", EDGE_ORDERING::BLOCKED)
+};
+
 /*!
  * \brief Types of analytic definitions for various geometries
  */
@@ -0,0 +1,92 @@
+/*!
+ * \file CBinomialCheckpointing.hpp
+ * \brief Binomial (Revolve) checkpointing schedule for the reversal of time-stepping loops.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+/*!
+ * \class CBinomialCheckpointing
+ * \brief Decides which states of a time-stepping loop are stored when it has to be reversed with a
+ * limited number of checkpoints (A. Griewank, A. Walther, "Algorithm 799: Revolve", 2000).
+ * \details The steps are requested in decreasing order. For each request the caller restores the
+ * closest checkpoint at or before the requested step (Restore), advances to the step, and asks after
+ * each intermediate step whether its state should be stored (Store). The state before step 0 (step -1)
+ * is the initial condition, it is assumed to be available and does not use a checkpoint.
+ * With s checkpoints and r recomputations per step beta(s,r) = (s+r)!/(s!r!) steps can be reversed.
+ */
+class CBinomialCheckpointing {
+ private:
+  unsigned short nCheckpoints;   /*!< \brief Maximum number of stored states. */
+  std::vector<long> checkpoints; /*!< \brief Steps of the stored states, in increasing order. */
+  unsigned long nAdvances = 0;   /*!< \brief Number of steps advanced to serve the requests. */
+  long nextTarget = -1;          /*!< \brief Requested step for which nextStep was computed. */
+  long nextStep = -1;            /*!< \brief Where the next state is stored while advancing to nextTarget. */
+
+  /*!
+   * \brief Step at which the next state is stored while advancing to a target, -1 if none.
+   */
+  long NextCheckpoint(long target) const;
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nCheckpoints - Maximum number of stored states.
+   */
+  explicit CBinomialCheckpointing(unsigned short nCheckpoints) : nCheckpoints(nCheckpoints) {}
+
+  /*!
+   * \brief Number of steps that can be reversed with s checkpoints and r recomputations.
+   * \return The binomial coefficient (s+r over s), saturated to the largest unsigned long.
+   */
+  static unsigned long Beta(unsigned long s, unsigned long r);
+
+  /*!
+   * \brief Prepare the computation of a step, checkpoints after it are discarded.
+   * \param[in] step - Requested step, smaller than the previously requested one.
+   * \return Step of the stored state from which to advance (the step itself if it was stored, -1 for the
+   * initial condition).
+   */
+  long Restore(long step);
+
+  /*!
+   * \brief Decide whether the state of a step computed while advancing towards a requested step is stored.
+   * \param[in] step - Step that was just computed.
+   * \param[in] target - Requested step.
+   * \return True if the caller must store the state of the step.
+   */
+  bool Store(long step, long target);
+
+  /*!
+   * \brief Steps of the stored states, in increasing order.
+   */
+  const std::vector<long>& GetCheckpoints() const { return checkpoints; }
+
+  /*!
+   * \brief Number of steps the caller had to advance so far (forward sweep included).
+   */
+  unsigned long GetnAdvances() const { return nAdvances; }
+};
@@ -0,0 +1,77 @@
+/*!
+ * \file CCacheFile.hpp
+ * \brief Binary cache files for the graph partitioning and the wall distance.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \class CCacheFile
+ * \brief Reads and writes one block of bytes per rank to a single file (with MPI-IO in parallel).
+ * \details The file stores the number of ranks, a global key, and for each rank a local key and the
+ * size of its block. The keys are hashes of the inputs that determine the cached data (e.g. the
+ * coordinates of the points of each rank), a cache is only used if all of them match on all ranks.
+ * Used for the graph partitioning and the wall distance (PARTITION_WALLDIST_CACHE).
+ */
+class CCacheFile {
+ public:
+  /*!
+   * \brief FNV-1a hash of a block of bytes.
+   * \param[in] data - Start of the block.
+   * \param[in] nBytes - Size of the block.
+   * \param[in] hash - Hash of the previous blocks, to combine several blocks.
+   */
+  static uint64_t Hash(const void* data, size_t nBytes, uint64_t hash = 14695981039346656037ull) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nBytes; ++i) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  /*!
+   * \brief Write a cache file (collective), a warning is printed if it cannot be written.
+   * \param[in] fileName - Name of the file.
+   * \param[in] key - Global key, must be the same on all ranks.
+   * \param[in] localKey - Key of the data of this rank.
+   * \param[in] localData - Block of this rank.
+   */
+  static void Write(const std::string& fileName, uint64_t key, uint64_t localKey, const std::vector<char>& localData);
+
+  /*!
+   * \brief Read a cache file (collective).
+   * \param[in] fileName - Name of the file.
+   * \param[in] key - Global key, must be the same on all ranks.
+   * \param[in] localKey - Key of the data of this rank.
+   * \param[in,out] localData - Sized by the caller to the expected size of the block of this rank.
+   * \return True (on all ranks) if the file exists and its keys and sizes match on all ranks.
+   */
+  static bool Read(const std::string& fileName, uint64_t key, uint64_t localKey, std::vector<char>& localData);
+};
@@ -0,0 +1,104 @@
+/*!
+ * \file CMemoryMappedFile.hpp
+ * \brief Read-only memory mapping of a file.
+ *        The implementations are in the <i>CMemoryMappedFile.cpp</i> file.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*!
+ * \class CMemoryMappedFile
+ * \brief Maps a whole file into memory (POSIX mmap), the pages are loaded on first access and shared
+ *        by all processes of a node that map the same file. The mapping is read-only, it does not count
+ *        against the commit limit of the system. Move-only, the file is unmapped on destruction.
+ */
+class CMemoryMappedFile {
+ private:
+  const char* ptr = nullptr; /*!< \brief Start of the mapping. */
+  size_t nBytes = 0;         /*!< \brief Size of the mapping (i.e. of the file). */
+
+ public:
+  CMemoryMappedFile() = default;
+
+  /*!
+   * \brief Map a file, see Open.
+   */
+  explicit CMemoryMappedFile(const std::string& fileName) { Open(fileName); }
+
+  ~CMemoryMappedFile() { Close(); }
+
+  CMemoryMappedFile(const CMemoryMappedFile&) = delete;
+  CMemoryMappedFile& operator=(const CMemoryMappedFile&) = delete;
+
+  CMemoryMappedFile(CMemoryMappedFile&& other) noexcept : ptr(other.ptr), nBytes(other.nBytes) {
+    other.ptr = nullptr;
+    other.nBytes = 0;
+  }
+
+  CMemoryMappedFile& operator=(CMemoryMappedFile&& other) noexcept {
+    if (this != &other) {
+      Close();
+      ptr = other.ptr;
+      nBytes = other.nBytes;
+      other.ptr = nullptr;
+      other.nBytes = 0;
+    }
+    return *this;
+  }
+
+  /*!
+   * \brief Check whether files can be mapped on this platform.
+   */
+  static bool IsSupported();
+
+  /*!
+   * \brief Map a file (unmapping the current one).
+   * \param[in] fileName - Name of the file.
+   * \return False if the file could not be opened or mapped (or if it is empty).
+   */
+  bool Open(const std::string& fileName);
+
+  /*!
+   * \brief Unmap the file.
+   */
+  void Close();
+
+  /*!
+   * \brief Check whether a file is mapped.
+   */
+  bool IsOpen() const { return ptr != nullptr; }
+
+  /*!
+   * \brief Start of the mapped file.
+   */
+  const char* Data() const { return ptr; }
+
+  /*!
+   * \brief Size of the mapped file in bytes.
+   */
+  size_t Size() const { return nBytes; }
+};
@@ -0,0 +1,153 @@
+/*!
+ * \file CPhaseProfiler.hpp
+ * \brief Hierarchical timer for coarse phases of the code (e.g. preprocessing).
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \class CPhaseProfiler
+ * \brief Measures the wall time and memory high-water mark of named phases, which can be nested.
+ * \details Phases started while another is active become its children, repeated phases (same name
+ * and parent) are accumulated. The timings are reduced over all ranks (min/avg/max) when reporting,
+ * therefore all ranks must go through the same sequence of phases. Start and Stop must be called
+ * outside of parallel regions.
+ */
+class CPhaseProfiler {
+ public:
+  /*!
+   * \brief Starts a phase on construction and stops it on destruction.
+   */
+  class CScope {
+   private:
+    CPhaseProfiler& profiler;
+
+   public:
+    CScope(CPhaseProfiler& val_profiler, const std::string& name) : profiler(val_profiler) { profiler.Start(name); }
+    ~CScope() { profiler.Stop(); }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+  };
+
+ private:
+  struct PhaseData {
+    std::string path;       /*!< \brief Names of the parents and of the phase separated by "/". */
+    unsigned short depth;   /*!< \brief Nesting level, 0 for the top level phases. */
+    unsigned long nCalls;   /*!< \brief Number of times the phase was started. */
+    double time;            /*!< \brief Accumulated wall time [s]. */
+    double memPeak;         /*!< \brief Largest memory high-water mark reached during a call of the phase [MB]. */
+    double memGrowth;       /*!< \brief Accumulated growth of the resident memory during the phase [MB]. */
+  };
+
+  std::vector<PhaseData> phases;                 /*!< \brief Phases in the order they were first started. */
+  std::vector<std::pair<size_t, double> > stack; /*!< \brief Active phases with their start time. */
+  std::vector<double> startMemory;               /*!< \brief Resident memory when the active phases started. */
+  std::vector<double> stackPeak;                 /*!< \brief High-water marks of the active phases so far. */
+
+ public:
+  /*!
+   * \brief Start a phase, nested in the currently active phase (if any).
+   * \param[in] name - Name of the phase (should not contain "/").
+   */
+  void Start(const std::string& name);
+
+  /*!
+   * \brief Stop the most recently started phase.
+   */
+  void Stop();
+
+  /*!
+   * \brief Discard all measurements.
+   */
+  void Clear() {
+    phases.clear();
+    stack.clear();
+    startMemory.clear();
+    stackPeak.clear();
+  }
+
+  /*!
+   * \brief Number of distinct phases measured.
+   */
+  size_t GetnPhases() const { return phases.size(); }
+
+  /*!
+   * \brief Full name ("parent/child") of a phase.
+   */
+  const std::string& GetPath(size_t iPhase) const { return phases[iPhase].path; }
+
+  /*!
+   * \brief Nesting level of a phase.
+   */
+  unsigned short GetDepth(size_t iPhase) const { return phases[iPhase].depth; }
+
+  /*!
+   * \brief Number of times a phase was started.
+   */
+  unsigned long GetnCalls(size_t iPhase) const { return phases[iPhase].nCalls; }
+
+  /*!
+   * \brief Accumulated wall time of a phase on this rank.
+   */
+  double GetTime(size_t iPhase) const { return phases[iPhase].time; }
+
+  /*!
+   * \brief Resident memory of the process [MB] (0 if not available on this platform).
+   */
+  static double CurrentMemory();
+
+  /*!
+   * \brief Memory high-water mark of the process [MB] (0 if not available on this platform).
+   */
+  static double PeakMemory();
+
+  /*!
+   * \brief Reset the memory high-water mark to the current resident memory.
+   * \note Only possible on Linux, elsewhere (or if not permitted) the high-water mark is that of the process
+   *       lifetime, i.e. the phases after the global peak all report the global peak.
+   * \return True if the mark was reset.
+   */
+  static bool ResetPeakMemory();
+
+  /*!
+   * \brief Reduce the measurements over all ranks, the master rank prints them as a table and/or writes a JSON file.
+   * \note This is a collective operation.
+   * \param[in] title - Printed above the table.
+   * \param[in] jsonFileName - If not empty, the reduced data is written to this file.
+   * \param[in] out - Stream for the table, not printed if null.
+   */
+  void Report(const std::string& title, const std::string& jsonFileName, std::ostream* out = &std::cout) const;
+
+ private:
+  /*!
+   * \brief Print the reduced measurements as an indented table.
+   */
+  void PrintTable(const std::string& title, const std::vector<double>& minVal, const std::vector<double>& sumVal,
+                  const std::vector<double>& maxVal, int size, std::ostream& out) const;
+};
@@ -0,0 +1,106 @@
+/*!
+ * \file CRestartData.hpp
+ * \brief Container for the data values read from a restart file.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../code_config.hpp"
+#include "CMemoryMappedFile.hpp"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+/*!
+ * \class CRestartData
+ * \brief Row-major (point by field) restart values of the points owned by a rank, in ascending order of
+ *        global index. The values are either stored in a buffer (vector-like interface) or accessed in
+ *        place in a memory mapped restart file, in which case only a table of the rows that are needed
+ *        is kept, i.e. there is no temporary copy of the data.
+ * \note The data section of SU2 binary restart files is not necessarily aligned to 8 bytes, therefore the
+ *       mapped values are copied out one by one and elements are accessed by value.
+ */
+class CRestartData {
+ private:
+  std::vector<passivedouble> buffer; /*!< \brief Values, when they are not mapped. */
+  CMemoryMappedFile file;            /*!< \brief Mapped restart file. */
+  const char* mapped = nullptr;      /*!< \brief Start of the data section in the mapped file. */
+  std::vector<unsigned long> rows;   /*!< \brief Row of the file for each point, empty if all rows are used. */
+  unsigned long nFields = 0;         /*!< \brief Number of values per row. */
+
+  passivedouble Mapped(size_t i) const {
+    const auto iRow = i / nFields;
+    const auto iField = i % nFields;
+    const auto pos = (rows.empty() ? iRow : rows[iRow]) * nFields + iField;
+    passivedouble val;
+    std::memcpy(&val, mapped + pos * sizeof(passivedouble), sizeof(passivedouble));
+    return val;
+  }
+
+ public:
+  /*!
+   * \brief Use the values of a mapped restart file in place.
+   * \param[in] mappedFile - The mapped file, ownership is transferred.
+   * \param[in] offset - Position of the data section in the file (bytes).
+   * \param[in] valFields - Number of values per point.
+   * \param[in] valRows - Row of the file for each point, empty for all rows.
+   */
+  void Map(CMemoryMappedFile&& mappedFile, size_t offset, unsigned long valFields,
+           std::vector<unsigned long> valRows) {
+    buffer = std::vector<passivedouble>();
+    file = std::move(mappedFile);
+    mapped = file.Data() + offset;
+    rows = std::move(valRows);
+    nFields = valFields;
+  }
+
+  /*!
+   * \brief Check whether the values are in a mapped file.
+   */
+  bool IsMapped() const { return mapped != nullptr; }
+
+  /*!
+   * \brief Release the mapped file (if any) and resize the buffer.
+   */
+  void resize(size_t n) {
+    if (IsMapped()) *this = CRestartData();
+    buffer.resize(n);
+  }
+
+  /*!
+   * \brief Release all memory.
+   */
+  void clear() { *this = CRestartData(); }
+
+  /*!
+   * \brief Start of the buffer, to write the values, not valid in mapped mode.
+   */
+  passivedouble* data() { return buffer.data(); }
+
+  /*!
+   * \brief Read a value (by value since the mapped values may not be aligned).
+   */
+  passivedouble operator[](size_t i) const { return IsMapped() ? Mapped(i) : buffer[i]; }
+};
@@ -0,0 +1,72 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Block compression of floating point arrays (used for restart files).
+ *        The implementations are in the <i>compression_toolbox.cpp</i> file.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace CompressionToolbox {
+/// \addtogroup CompressionToolbox
+/// @{
+
+/*!
+ * \brief Number of mantissa bits that can be dropped while keeping a relative rounding error below tol.
+ * \param[in] tol - Relative tolerance, 0 (or less) for lossless compression.
+ * \return Number of low bits (0 to 52) to drop.
+ */
+int DroppedBits(double tol);
+
+/*!
+ * \brief Compress a block of point-major data (nPoint rows of nField values) and append it to a byte buffer.
+ * \note Each field (column) is compressed separately by XOR with the previous value of the same field and
+ *       by storing only the non-zero bytes of the result. This works well for smooth fields.
+ * \param[in] data - The data to compress.
+ * \param[in] nPoint - Number of points (rows).
+ * \param[in] nField - Number of fields (columns).
+ * \param[in] droppedBits - Number of low bits to drop (after rounding) for each field, see DroppedBits.
+ * \param[in,out] buffer - Where the compressed bytes are appended.
+ */
+void CompressBlock(const double* data, unsigned long nPoint, unsigned long nField, const int* droppedBits,
+                   std::vector<uint8_t>& buffer);
+
+/*!
+ * \brief Decompress a block created by CompressBlock.
+ * \param[in] buffer - Start of the compressed block.
+ * \param[in] nBytes - Size of the compressed block.
+ * \param[in] nPoint - Number of points (rows).
+ * \param[in] nField - Number of fields (columns).
+ * \param[in] droppedBits - Number of low bits that were dropped for each field.
+ * \param[out] data - Point-major output array (nPoint x nField).
+ * \return False if the block is inconsistent with its size.
+ */
+bool DecompressBlock(const uint8_t* buffer, unsigned long nBytes, unsigned long nPoint, unsigned long nField,
+                     const int* droppedBits, double* data);
+
+/// @}
+}  // namespace CompressionToolbox
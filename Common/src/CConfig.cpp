@@ -36,6 +36,7 @@
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 using namespace PrintingToolbox;
 
@@ -703,6 +704,10 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
       nZone = 1;
       break;
     }
+    case SU2_BINARY: {
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -813,6 +818,25 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is the first entry of the header, after the magic string. ---*/
+      ifstream mesh_file(val_mesh_filename, ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+
+      char magic[SU2BinaryMesh::magicSize] = {0};
+      int64_t header[SU2BinaryMesh::HEADER_SIZE] = {0};
+      mesh_file.read(magic, sizeof(magic));
+      mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+      if (!mesh_file || strncmp(magic, SU2BinaryMesh::magic, SU2BinaryMesh::magicSize) != 0) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file. Please check."), CURRENT_FUNCTION);
+      }
+      nDim = header[SU2BinaryMesh::NDIME];
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -1049,6 +1073,7 @@ void CConfig::SetPointersNull() {
   ScreenOutput = nullptr;
   HistoryOutput = nullptr;
   VolumeOutput = nullptr;
+  Extract_Fields = nullptr;
   VolumeOutputFiles = nullptr;
   VolumeOutputFrequencies = nullptr;
   ConvField = nullptr;
@@ -1740,6 +1765,8 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Compute the matrix-free products of the NK method with forward mode AD instead of finite differences. */
+  addBoolOption("NEWTON_KRYLOV_AD_PRODUCTS", NK_ADProducts, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1791,6 +1818,9 @@ void CConfig::SetConfig_Options() {
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of direct states kept in memory to recompute the direct solution for the unsteady adjoint,
+   * 0 loads the direct solution of each time step from restart files. */
+  addUnsignedShortOption("UNST_ADJOINT_CHECKPOINTS", nUnst_AdjointCheckpoints, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
@@ -1837,6 +1867,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Use a sliced ELLPACK (SELL-C-sigma) copy of the matrix in the Krylov products of systems with 1 or 2 variables. */
+  addBoolOption("LINEAR_SOLVER_SLICED_ELL", Linear_Solver_Sliced_ELL, false);
+  /* DESCRIPTION: Storage precision of the ILU factors and Jacobi inverses applied in the linear iterations. */
+  addEnumOption("LINEAR_SOLVER_PREC_STORAGE", Kind_Linear_Solver_Prec_Storage, Prec_Storage_Map, PREC_STORAGE::FULL);
+  /* DESCRIPTION: Parallelize the ILU and LU_SGS triangular solves by level scheduling instead of partitioning the rows. */
+  addBoolOption("LINEAR_SOLVER_LEVEL_SCHEDULING", Linear_Solver_Level_Scheduling, false);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -2173,6 +2209,55 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /*!\brief WRT_PREPROC_PROFILE
+   *  \n DESCRIPTION: Output the time and memory of each preprocessing phase at the end of the preprocessing \ingroup Config*/
+  addBoolOption("WRT_PREPROC_PROFILE", Wrt_Preproc_Profile, false);
+  /*!\brief PREPROC_PROFILE_FILENAME
+   *  \n DESCRIPTION: JSON file for the preprocessing profile, not written if empty \ingroup Config*/
+  addStringOption("PREPROC_PROFILE_FILENAME", Preproc_Profile_FileName, string(""));
+  /*!\brief PARTITION_WALLDIST_CACHE
+   *  \n DESCRIPTION: Store the graph partitioning and wall distance in cache files and reuse them in later runs \ingroup Config*/
+  addBoolOption("PARTITION_WALLDIST_CACHE", Partition_WallDist_Cache, false);
+  /*!\brief PARTITION_WALLDIST_CACHE_FILENAME
+   *  \n DESCRIPTION: Base name of the partitioning and wall distance cache files (w/o extension) \ingroup Config*/
+  addStringOption("PARTITION_WALLDIST_CACHE_FILENAME", Partition_WallDist_Cache_FileName,
+                  string("partition_walldist_cache"));
+  /*!\brief WALL_DISTANCE_DISTRIBUTED
+   *  \n DESCRIPTION: Compute the wall distance with the walls of each rank in a local tree instead of gathering all walls on all ranks \ingroup Config*/
+  addBoolOption("WALL_DISTANCE_DISTRIBUTED", WallDistance_Distributed, false);
+  /*!\brief OUTPUT_ASYNC
+   *  \n DESCRIPTION: Write the output files in a background thread, requires --thread_multiple with MPI \ingroup Config*/
+  addBoolOption("OUTPUT_ASYNC", Output_Async, false);
+  /*!\brief RESTART_COMPRESSION
+   *  \n DESCRIPTION: Compression of the binary restart files (NONE, LOSSLESS, LOSSY) \ingroup Config*/
+  addEnumOption("RESTART_COMPRESSION", Restart_Compression, Restart_Compression_Map, RESTART_COMPRESSION::NONE);
+  /*!\brief RESTART_COMPRESSION_TOL
+   *  \n DESCRIPTION: Relative tolerance of the fields compressed with RESTART_COMPRESSION= LOSSY \ingroup Config*/
+  addDoubleOption("RESTART_COMPRESSION_TOL", Restart_Compression_Tol, 1e-6);
+  /*!\brief RESTART_MMAP
+   *  \n DESCRIPTION: Read binary restart files through a memory mapping, without a temporary copy of the data \ingroup Config*/
+  addBoolOption("RESTART_MMAP", Restart_Mmap, false);
+  /*!\brief EXTRACT_KIND
+   *  \n DESCRIPTION: Elements written to the EXTRACT_* output files (BOX, SLICE, ISOSURFACE) \ingroup Config*/
+  addEnumOption("EXTRACT_KIND", Kind_Extract, Extract_Map, EXTRACT_KIND::BOX);
+  /*!\brief EXTRACT_BOX
+   *  \n DESCRIPTION: Extraction box (xmin, ymin, zmin, xmax, ymax, zmax) \ingroup Config*/
+  for (auto& x : Extract_Box) x = 0.0;
+  addDoubleArrayOption("EXTRACT_BOX", 6, Extract_Box);
+  /*!\brief EXTRACT_PLANE
+   *  \n DESCRIPTION: Extraction plane (x, y, z of a point, x, y, z of the normal) \ingroup Config*/
+  for (auto& x : Extract_Plane) x = 0.0;
+  Extract_Plane[3] = 1.0;
+  addDoubleArrayOption("EXTRACT_PLANE", 6, Extract_Plane);
+  /*!\brief EXTRACT_ISOSURFACE_FIELD
+   *  \n DESCRIPTION: Volume output field that defines the extraction iso-surface \ingroup Config*/
+  addStringOption("EXTRACT_ISOSURFACE_FIELD", Extract_IsoField, string(""));
+  /*!\brief EXTRACT_ISOSURFACE_VALUE
+   *  \n DESCRIPTION: Value of the extraction iso-surface \ingroup Config*/
+  addDoubleOption("EXTRACT_ISOSURFACE_VALUE", Extract_IsoValue, 0.0);
+  /*!\brief EXTRACT_FIELDS
+   *  \n DESCRIPTION: Volume output fields or groups written to the extract files, all if empty \ingroup Config*/
+  addStringListOption("EXTRACT_FIELDS", nExtract_Fields, Extract_Fields);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2930,6 +3015,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Allow fallback to smaller edge color group sizes for the discrete adjoint and allow more colors. */
   addBoolOption("EDGE_COLORING_RELAX_DISC_ADJ", edgeColoringRelaxDiscAdj, true);
 
+  /* DESCRIPTION: Renumbering of the points after partitioning (RCM, HILBERT, MORTON). */
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, POINT_ORDERING::RCM);
+
+  /* DESCRIPTION: Numbering of the edges used by the edge loops (NATURAL, BLOCKED). */
+  addEnumOption("EDGE_ORDERING", Kind_Edge_Ordering, Edge_Ordering_Map, EDGE_ORDERING::NATURAL);
+
+  /* DESCRIPTION: Number of points per block for the blocked edge ordering. */
+  addUnsignedLongOption("EDGE_ORDERING_BLOCK_SIZE", edgeOrderingBlockSize, 2048);
+
+  /* DESCRIPTION: Report the throughput and estimated cache misses of a model edge loop before and after renumbering. */
+  addBoolOption("EDGE_ORDERING_BENCHMARK", edgeOrderingBenchmark, false);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -4876,6 +4973,20 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   if (Fixed_CL_Mode) Update_AoA = false;
 
+  if (NK_ADProducts) {
+#ifndef CODI_FORWARD_TYPE
+    if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
+      SU2_MPI::Error("NEWTON_KRYLOV_AD_PRODUCTS= YES requires forward mode AD support.\n"
+                     "Please use SU2_CFD_DIRECTDIFF (meson.py ... -Denable-directdiff=true ...).",
+                     CURRENT_FUNCTION);
+    }
+#endif
+    if (DirectDiff != NO_DERIVATIVE) {
+      SU2_MPI::Error("NEWTON_KRYLOV_AD_PRODUCTS= YES cannot be combined with DIRECT_DIFF,\n"
+                     "both need the derivative component of the forward mode AD type.", CURRENT_FUNCTION);
+    }
+  }
+
   if (DirectDiff != NO_DERIVATIVE) {
 #ifndef CODI_FORWARD_TYPE
     if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
@@ -5258,6 +5369,30 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
 
+  /*--- The distributed wall distance search communicates passive values and only supports the FVM geometry. ---*/
+  if (WallDistance_Distributed && (DiscreteAdjoint || DirectDiff != NO_DERIVATIVE ||
+                                   Kind_Solver == MAIN_SOLVER::FEM_RANS || Kind_Solver == MAIN_SOLVER::FEM_LES)) {
+    SU2_MPI::Error("WALL_DISTANCE_DISTRIBUTED is not available with the discrete adjoint, direct differentiation,\n"
+                   "or the DG-FEM solvers.", CURRENT_FUNCTION);
+  }
+
+  /*--- The checkpointed unsteady adjoint recomputes the direct solution on a static mesh. ---*/
+  if (nUnst_AdjointCheckpoints > 0) {
+    const bool fvmFluid = Kind_Solver == MAIN_SOLVER::EULER || Kind_Solver == MAIN_SOLVER::NAVIER_STOKES ||
+                          Kind_Solver == MAIN_SOLVER::RANS || Kind_Solver == MAIN_SOLVER::INC_EULER ||
+                          Kind_Solver == MAIN_SOLVER::INC_NAVIER_STOKES || Kind_Solver == MAIN_SOLVER::INC_RANS;
+    const bool dualTime = TimeMarching == TIME_MARCHING::DT_STEPPING_1ST ||
+                          TimeMarching == TIME_MARCHING::DT_STEPPING_2ND;
+    if (!DiscreteAdjoint || !fvmFluid || !dualTime || Multizone_Problem || GetBoolTurbomachinery()) {
+      SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS requires a single zone discrete adjoint of the finite volume\n"
+                     "fluid solvers with dual time stepping.", CURRENT_FUNCTION);
+    }
+    if (GetGrid_Movement() || Deform_Mesh || Wind_Gust || nMGLevels > 0 || Frozen_Visc_Disc) {
+      SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is not available with grid movement, mesh deformation, wind gusts,\n"
+                     "multigrid, or FROZEN_VISC_DISC.", CURRENT_FUNCTION);
+    }
+  }
+
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
     if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
@@ -6974,8 +7109,14 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_FGMRES:
+            case PIPELINED_BCGSTAB:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6983,6 +7124,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6991,6 +7133,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -7015,12 +7158,12 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
         case STRUCT_TIME_INT::NEWMARK_IMPLICIT:
           if (Time_Domain) cout << "Newmark implicit method for the structural time integration." << endl;
           switch (Kind_Linear_Solver) {
-            case BCGSTAB:
+            case BCGSTAB: case PIPELINED_BCGSTAB:
               cout << "BCGSTAB is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_FGMRES:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
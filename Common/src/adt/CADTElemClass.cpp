@@ -29,6 +29,8 @@
 #include "../../include/parallelization/mpi_structure.hpp"
 #include "../../include/option_structure.hpp"
 
+#include <limits>
+
 /* Define the tolerance to decide whether or not a point is inside an element. */
 const su2double tolInsideElem = 1.e-10;
 const su2double paramLowerBound = -1.0 - tolInsideElem;
@@ -336,6 +338,202 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
   return false;
 }
 
+void CADTElemClass::DetermineNearestElementDistributed(const unsigned long nPoints, const su2double* coor,
+                                                       const int* rankHint, su2double* dist,
+                                                       unsigned short* markerID, unsigned long* elemID,
+                                                       int* rankID) {
+  /*--- Search the local tree first, which gives an upper bound for the distance. ---*/
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long i = 0; i < nPoints; ++i) {
+      if (isEmpty) {
+        dist[i] = numeric_limits<su2double>::max();
+        rankID[i] = -1;
+      } else {
+        DetermineNearestElement(coor + i * nDim, dist[i], markerID[i], elemID[i], rankID[i]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+#ifdef HAVE_MPI
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  if (size == SINGLE_NODE) return;
+
+  /*--- Make the bounding boxes of the elements of all ranks available, the box of
+        a rank without elements has its minimum coordinates above the maximum. ---*/
+
+  vector<passivedouble> localBox(2 * nDim), boxes(2 * nDim * size);
+  for (unsigned short k = 0; k < nDim; ++k) {
+    localBox[k] = numeric_limits<passivedouble>::max();
+    localBox[nDim + k] = numeric_limits<passivedouble>::lowest();
+  }
+  for (unsigned long i = 0; i < elemVTK_Type.size(); ++i) {
+    const su2double* BBMin = BBoxCoor.data() + 2 * nDim * i;
+    const su2double* BBMax = BBMin + nDim;
+    for (unsigned short k = 0; k < nDim; ++k) {
+      localBox[k] = min(localBox[k], SU2_TYPE::GetValue(BBMin[k]));
+      localBox[nDim + k] = max(localBox[nDim + k], SU2_TYPE::GetValue(BBMax[k]));
+    }
+  }
+  SelectMPIWrapper<passivedouble>::W::Allgather(localBox.data(), 2 * nDim, MPI_DOUBLE, boxes.data(), 2 * nDim,
+                                                MPI_DOUBLE, SU2_MPI::GetComm());
+
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank != rank && boxes[2 * nDim * iRank] <= boxes[2 * nDim * iRank + nDim]) wallRanks.push_back(iRank);
+  }
+
+  /*--- Squared distance from a point to the box of a rank, a lower bound for the distance
+        to the elements of that rank, and squared distance found so far for a point. ---*/
+
+  auto Dist2ToBox = [&](int iRank, const su2double* x) {
+    const passivedouble* boxMin = boxes.data() + 2 * nDim * iRank;
+    const passivedouble* boxMax = boxMin + nDim;
+    passivedouble d2 = 0.0;
+    for (unsigned short k = 0; k < nDim; ++k) {
+      const passivedouble xk = SU2_TYPE::GetValue(x[k]);
+      const passivedouble dk = max(0.0, max(boxMin[k] - xk, xk - boxMax[k]));
+      d2 += dk * dk;
+    }
+    return d2;
+  };
+  auto Dist2Found = [&](unsigned long i) {
+    const passivedouble d = SU2_TYPE::GetValue(dist[i]);
+    return d * d;
+  };
+
+  /*--- First round, each point is sent to at most one rank, the hinted one if its box
+        is closer than the bound, otherwise the one with the closest box. ---*/
+
+  vector<vector<unsigned long> > requests(size);
+  vector<int> firstTarget(nPoints, -1);
+
+  for (unsigned long i = 0; i < nPoints; ++i) {
+    const su2double* x = coor + i * nDim;
+    passivedouble bound = Dist2Found(i);
+
+    const int hint = rankHint ? rankHint[i] : -1;
+    if (hint >= 0 && hint < size && hint != rank && Dist2ToBox(hint, x) < bound) {
+      firstTarget[i] = hint;
+    } else {
+      for (const auto iRank : wallRanks) {
+        const auto d2 = Dist2ToBox(iRank, x);
+        if (d2 < bound) {
+          bound = d2;
+          firstTarget[i] = iRank;
+        }
+      }
+    }
+    if (firstTarget[i] >= 0) requests[firstTarget[i]].push_back(i);
+  }
+  ExchangeNearestElementQueries(requests, coor, dist, markerID, elemID, rankID);
+
+  /*--- Second round, all other ranks that can still hold a closer element. ---*/
+
+  for (auto& request : requests) request.clear();
+
+  for (unsigned long i = 0; i < nPoints; ++i) {
+    const su2double* x = coor + i * nDim;
+    const passivedouble bound = Dist2Found(i);
+    for (const auto iRank : wallRanks) {
+      if (iRank != firstTarget[i] && Dist2ToBox(iRank, x) < bound) requests[iRank].push_back(i);
+    }
+  }
+  ExchangeNearestElementQueries(requests, coor, dist, markerID, elemID, rankID);
+#endif
+}
+
+void CADTElemClass::ExchangeNearestElementQueries(const vector<vector<unsigned long> >& requests,
+                                                  const su2double* coor, su2double* dist, unsigned short* markerID,
+                                                  unsigned long* elemID, int* rankID) {
+#ifdef HAVE_MPI
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+  const auto comm = SU2_MPI::GetComm();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Number of points to send to and receive from each rank, and offsets of the blocks of each rank. ---*/
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) nSend[iRank] = requests[iRank].size();
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  /*--- The same counts and offsets scaled by the number of values per point. ---*/
+  auto Scale = [](vector<int> v, int factor) {
+    for (auto& val : v) val *= factor;
+    return v;
+  };
+
+  /*--- Send the coordinates (as passive values). ---*/
+
+  vector<passivedouble> sendCoor(sendDispl[size] * nDim), recvCoor(recvDispl[size] * nDim);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    auto* buf = sendCoor.data() + sendDispl[iRank] * nDim;
+    for (const auto i : requests[iRank]) {
+      for (unsigned short k = 0; k < nDim; ++k) *(buf++) = SU2_TYPE::GetValue(coor[i * nDim + k]);
+    }
+  }
+  MPI_Wrapper::Alltoallv(sendCoor.data(), Scale(nSend, nDim).data(), Scale(sendDispl, nDim).data(), MPI_DOUBLE,
+                         recvCoor.data(), Scale(nRecv, nDim).data(), Scale(recvDispl, nDim).data(), MPI_DOUBLE,
+                         comm);
+
+  /*--- Search the local tree for the received points. ---*/
+
+  const unsigned long nQuery = recvDispl[size];
+  vector<passivedouble> answerDist(nQuery);
+  vector<unsigned long> answerIDs(2 * nQuery);
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long j = 0; j < nQuery; ++j) {
+      su2double x[3] = {0.0}, d = 0.0;
+      for (unsigned short k = 0; k < nDim; ++k) x[k] = recvCoor[j * nDim + k];
+      unsigned short marker = 0;
+      unsigned long elem = 0;
+      int elemRank = 0;
+      DetermineNearestElement(x, d, marker, elem, elemRank);
+      answerDist[j] = SU2_TYPE::GetValue(d);
+      answerIDs[2 * j] = marker;
+      answerIDs[2 * j + 1] = elem;
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Return the answers, the communication pattern is reversed. ---*/
+
+  vector<passivedouble> replyDist(sendDispl[size]);
+  vector<unsigned long> replyIDs(2 * sendDispl[size]);
+
+  MPI_Wrapper::Alltoallv(answerDist.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE, replyDist.data(),
+                         nSend.data(), sendDispl.data(), MPI_DOUBLE, comm);
+  SU2_MPI::Alltoallv(answerIDs.data(), Scale(nRecv, 2).data(), Scale(recvDispl, 2).data(), MPI_UNSIGNED_LONG,
+                     replyIDs.data(), Scale(nSend, 2).data(), Scale(sendDispl, 2).data(), MPI_UNSIGNED_LONG, comm);
+
+  /*--- Keep the answers that are closer than what was found so far. ---*/
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (int j = 0; j < nSend[iRank]; ++j) {
+      const auto i = requests[iRank][j];
+      const auto k = sendDispl[iRank] + j;
+      if (replyDist[k] < dist[i]) {
+        dist[i] = replyDist[k];
+        markerID[i] = replyIDs[2 * k];
+        elemID[i] = replyIDs[2 * k + 1];
+        rankID[i] = iRank;
+      }
+    }
+  }
+#endif
+}
+
 void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
                                                  vector<unsigned long>& frontLeaves,
                                                  vector<unsigned long>& frontLeavesNew, const su2double* coor,
@@ -26,6 +26,13 @@
  */
 
 #include "../../include/basic_types/datatype_structure.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+#include <vector>
 
 namespace AD {
 #ifdef CODI_REVERSE_TYPE
@@ -48,6 +55,21 @@ SU2_OMP(threadprivate(PreaccHelper))
 
 ExtFuncHelper FuncHelper;
 
+namespace {
+/*--- Tape memory [MB] per phase of the recording, in order of first appearance. ---*/
+std::vector<std::pair<std::string, double> > TapePhases;
+bool TapePhasesActive = false;
+int TapePhaseDepth = 0;
+size_t CurrentTapePhase = 0;
+double TapePhaseStart = 0.0;
+
+/*--- Wall time [s] of the recording and of the tape evaluations since. ---*/
+passivedouble RecordingStart = 0.0;
+passivedouble EvaluationStart = 0.0;
+passivedouble EvaluationTime = 0.0;
+unsigned long nEvaluation = 0;
+}  // namespace
+
 #endif
 
 void Initialize() {
@@ -59,4 +81,137 @@ void Initialize() {
 
 void Finalize() { AD::Reset(); }
 
+void ResetTapePhases(bool active) {
+#ifdef CODI_REVERSE_TYPE
+  TapePhases.clear();
+  TapePhasesActive = active;
+  TapePhaseDepth = 0;
+  RecordingStart = SU2_MPI::Wtime();
+  EvaluationTime = 0.0;
+  nEvaluation = 0;
+#endif
+}
+
+void StartTapePhase(const std::string& group, const char* phase) {
+#ifdef CODI_REVERSE_TYPE
+  if (!TapePhasesActive || omp_get_thread_num() != 0 || !getTape().isActive()) return;
+  if (TapePhaseDepth++ > 0) return;
+
+  const std::string name = group.empty() ? std::string(phase) : group + ": " + phase;
+  CurrentTapePhase = 0;
+  while (CurrentTapePhase < TapePhases.size() && TapePhases[CurrentTapePhase].first != name) ++CurrentTapePhase;
+  if (CurrentTapePhase == TapePhases.size()) TapePhases.emplace_back(name, 0.0);
+
+  TapePhaseStart = getTape().getTapeValues().getUsedMemorySize();
+#endif
+}
+
+void EndTapePhase() {
+#ifdef CODI_REVERSE_TYPE
+  if (!TapePhasesActive || omp_get_thread_num() != 0 || !getTape().isActive()) return;
+  if (--TapePhaseDepth > 0) return;
+
+  TapePhases[CurrentTapePhase].second += getTape().getTapeValues().getUsedMemorySize() - TapePhaseStart;
+#endif
+}
+
+void StartEvaluationTimer() {
+#ifdef CODI_REVERSE_TYPE
+  if (TapePhasesActive) EvaluationStart = SU2_MPI::Wtime();
+#endif
+}
+
+void StopEvaluationTimer() {
+#ifdef CODI_REVERSE_TYPE
+  if (!TapePhasesActive) return;
+  EvaluationTime += SU2_MPI::Wtime() - EvaluationStart;
+  ++nEvaluation;
+#endif
+}
+
+void PrintTapePhases() {
+#ifdef CODI_REVERSE_TYPE
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+  const auto comm = SU2_MPI::GetComm();
+
+  /*--- The slowest rank determines the time of the recording. ---*/
+
+  passivedouble recordingTime = SU2_MPI::Wtime() - RecordingStart, maxTime = 0.0;
+  MPI_Wrapper::Allreduce(&recordingTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, comm);
+
+  /*--- All ranks record the same phases in the same order, unless some rank skipped a solver
+   * or routine entirely, in that case only the master values are shown. ---*/
+
+  unsigned long nPhase = TapePhases.size(), minPhase = 0, maxPhase = 0;
+  SU2_MPI::Allreduce(&nPhase, &minPhase, 1, MPI_UNSIGNED_LONG, MPI_MIN, comm);
+  SU2_MPI::Allreduce(&nPhase, &maxPhase, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm);
+  const bool allRanks = (minPhase == maxPhase);
+
+  std::vector<passivedouble> local(nPhase + 1), total(nPhase + 1);
+  for (auto i = 0ul; i < nPhase; ++i) local[i] = TapePhases[i].second;
+  local[nPhase] = getTape().getTapeValues().getUsedMemorySize();
+
+  if (allRanks) {
+    MPI_Wrapper::Allreduce(local.data(), total.data(), nPhase + 1, MPI_DOUBLE, MPI_SUM, comm);
+  } else {
+    total = local;
+  }
+
+  if (SU2_MPI::GetRank() != MASTER_NODE || nPhase == 0) return;
+
+  size_t width = 12;
+  for (const auto& phase : TapePhases) width = std::max(width, phase.first.size());
+
+  const auto flags = std::cout.flags();
+  const auto precision = std::cout.precision();
+
+  std::cout << "Tape memory per phase" << (allRanks ? "" : " (master rank only)") << "\n";
+  std::cout << "-------------------------------------\n";
+  std::cout << std::fixed << std::setprecision(1);
+  passivedouble measured = 0.0;
+  for (auto i = 0ul; i < nPhase; ++i) {
+    measured += total[i];
+    std::cout << "  " << std::left << std::setw(width) << TapePhases[i].first << " :  " << std::right << std::setw(10)
+              << total[i] << " MB  (" << std::setw(5) << 100.0 * total[i] / std::max(total[nPhase], 1e-12)
+              << " %)\n";
+  }
+  std::cout << "  " << std::left << std::setw(width) << "Other" << " :  " << std::right << std::setw(10)
+            << total[nPhase] - measured << " MB\n";
+  std::cout << "-------------------------------------\n";
+  std::cout << std::setprecision(3) << "  Recording time         :  " << maxTime << " s (" << omp_get_max_threads()
+            << " threads per rank)\n";
+  std::cout << "-------------------------------------\n" << std::endl;
+
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+#endif
+}
+
+void PrintEvaluationTimes() {
+#ifdef CODI_REVERSE_TYPE
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+
+  passivedouble maxTime = 0.0;
+  MPI_Wrapper::Allreduce(&EvaluationTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() == MASTER_NODE && nEvaluation > 0) {
+    const auto flags = std::cout.flags();
+    const auto precision = std::cout.precision();
+
+    std::cout << "\nTape evaluation\n";
+    std::cout << "-------------------------------------\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  Number of evaluations  :  " << nEvaluation << "\n";
+    std::cout << "  Time per evaluation    :  " << maxTime / nEvaluation << " s (" << omp_get_max_threads()
+              << " threads per rank)\n";
+    std::cout << "-------------------------------------\n" << std::endl;
+
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+  }
+  EvaluationTime = 0.0;
+  nEvaluation = 0;
+#endif
+}
+
 }  // namespace AD
@@ -28,7 +28,7 @@
 #include "../../include/fem/fem_geometry_structure.hpp"
 #include "../../include/adt/CADTElemClass.hpp"
 
-std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig* config) const {
+std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig* config, bool globalTree) const {
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -111,7 +111,7 @@ std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig*
 
   /* Build the ADT. */
   std::unique_ptr<CADTElemClass> WallADT(
-      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, true));
+      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, globalTree));
 
   return WallADT;
 }
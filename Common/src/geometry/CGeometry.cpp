@@ -25,9 +25,13 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <unordered_set>
 
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/toolboxes/CCacheFile.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
@@ -1247,37 +1251,190 @@ void CGeometry::PostPeriodicSends(CGeometry* geometry, const CConfig* config, un
 }
 
 void CGeometry::SetEdges() {
-  nEdge = 0;
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
-        if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
-          }
-          break;
-        }
+  /*--- An edge is created for each pair of points that are in each other's list of neighbors. The
+   edges are numbered by their lowest point and then in the order of the neighbors of that point.
+   The edges of each point are counted first, which makes the numbering independent of the number
+   of threads, and then numbered and stored in parallel (each point only writes its own edges). ---*/
+
+  /*--- Position of iPoint in the neighbors of jPoint, or -1 if the pair is not an edge. ---*/
+  auto mutualNeighbor = [this](unsigned long iPoint, unsigned long jPoint) {
+    for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
+      if (nodes->GetPoint(jPoint, jNode) == iPoint) return static_cast<long>(jNode);
+    }
+    return -1l;
+  };
+
+  vector<unsigned long> edgeOffset(nPoint + 1, 0);
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto jPoint : nodes->GetPoints(iPoint)) {
+        if (jPoint > iPoint && mutualNeighbor(iPoint, jPoint) >= 0) edgeOffset[iPoint + 1]++;
       }
     }
-  }
+    END_SU2_OMP_FOR
 
-  edges = new CEdge(nEdge, nDim);
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) edgeOffset[iPoint + 1] += edgeOffset[iPoint];
+      nEdge = edgeOffset[nPoint];
+      edges = new CEdge(nEdge, nDim);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto jPoint : nodes->GetPoints(iPoint)) {
-      if (iPoint < jPoint) {
-        auto iEdge = FindEdge(iPoint, jPoint);
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      auto iEdge = edgeOffset[iPoint];
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = nodes->GetPoint(iPoint, iNode);
+        if (jPoint < iPoint) continue;
+        const auto jNode = mutualNeighbor(iPoint, jPoint);
+        if (jNode < 0) continue;
+        nodes->SetEdge(iPoint, iEdge, iNode);
+        nodes->SetEdge(jPoint, iEdge, jNode);
         edges->SetNodes(iEdge, iPoint, jPoint);
+        iEdge++;
       }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+
   edges->SetPaddingNodes();
 }
 
+namespace {
+/*!
+ * \brief Interleave the bits of two 32-bit integers (Morton code).
+ */
+uint64_t mortonCode(uint64_t a, uint64_t b) {
+  auto spread = [](uint64_t x) {
+    x &= 0xffffffff;
+    x = (x | (x << 16)) & 0x0000ffff0000ffff;
+    x = (x | (x << 8)) & 0x00ff00ff00ff00ff;
+    x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0f;
+    x = (x | (x << 2)) & 0x3333333333333333;
+    x = (x | (x << 1)) & 0x5555555555555555;
+    return x;
+  };
+  return (spread(a) << 1) | spread(b);
+}
+
+/*!
+ * \brief Model edge loop (gather from two points, scatter to two points) and a direct-mapped
+ *        cache model of its accesses, used to compare edge orderings.
+ * \param[in] edges - Edge structure.
+ * \param[in] nEdge - Number of edges.
+ * \param[in] nPoint - Number of points.
+ * \param[out] time - Time per pass over the edges.
+ * \return Estimated cache misses.
+ */
+unsigned long benchmarkEdgeLoop(const CEdge& edges, unsigned long nEdge, unsigned long nPoint, passivedouble& time) {
+  /*--- Typical size of the point data of a flow solver (5 variables) and a 1 MiB cache of 64 byte lines. ---*/
+  constexpr unsigned long nVar = 5, lineSize = 64, nLines = 1ul << 14;
+  constexpr int nPasses = 5;
+
+  std::vector<passivedouble> U(nPoint * nVar, 1.0), R(nPoint * nVar, 0.0);
+
+  const auto t0 = SU2_MPI::Wtime();
+  for (int iPass = 0; iPass < nPasses; ++iPass) {
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+      const auto iPoint = edges.GetNode(iEdge, 0);
+      const auto jPoint = edges.GetNode(iEdge, 1);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        const passivedouble flux = 0.5 * (U[jPoint * nVar + iVar] - U[iPoint * nVar + iVar]);
+        R[iPoint * nVar + iVar] += flux;
+        R[jPoint * nVar + iVar] -= flux;
+      }
+    }
+    /*--- Keep the compiler from removing the loop. ---*/
+    U[iPass % U.size()] += 1e-16 * R[iPass % R.size()];
+  }
+  time = (SU2_MPI::Wtime() - t0) / nPasses;
+
+  std::vector<unsigned long> tags(nLines, std::numeric_limits<unsigned long>::max());
+  unsigned long misses = 0;
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    for (auto iNode = 0ul; iNode < 2; ++iNode) {
+      const auto first = edges.GetNode(iEdge, iNode) * nVar * sizeof(passivedouble) / lineSize;
+      const auto last = ((edges.GetNode(iEdge, iNode) + 1) * nVar * sizeof(passivedouble) - 1) / lineSize;
+      for (auto line = first; line <= last; ++line) {
+        auto& tag = tags[line % nLines];
+        misses += (tag != line);
+        tag = line;
+      }
+    }
+  }
+  return misses;
+}
+}  // namespace
+
+void CGeometry::SetEdgeOrdering(const CConfig* config) {
+  const bool benchmark = config->GetEdgeOrderingBenchmark();
+  const auto ordering = config->GetKind_Edge_Ordering();
+
+  if (ordering == EDGE_ORDERING::NATURAL && !benchmark) return;
+
+  /*--- Time the natural ordering. ---*/
+  passivedouble timeNatural = 0.0;
+  unsigned long missesNatural = 0;
+  if (benchmark) missesNatural = benchmarkEdgeLoop(*edges, nEdge, nPoint, timeNatural);
+
+  if (ordering == EDGE_ORDERING::BLOCKED) {
+    /*--- Sort the edges by the Morton code of the blocks of their two points, the sort is
+     *    stable to keep the natural order (by first point) within each pair of blocks. ---*/
+    const auto blockSize = max(config->GetEdgeOrderingBlockSize(), 1ul);
+
+    std::vector<uint64_t> key(nEdge);
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+      const auto iBlock = edges->GetNode(iEdge, 0) / blockSize;
+      const auto jBlock = edges->GetNode(iEdge, 1) / blockSize;
+      key[iEdge] = mortonCode(min(iBlock, jBlock), max(iBlock, jBlock));
+    }
+
+    std::vector<unsigned long> newToOld(nEdge);
+    std::iota(newToOld.begin(), newToOld.end(), 0ul);
+    std::stable_sort(newToOld.begin(), newToOld.end(),
+                     [&key](unsigned long a, unsigned long b) { return key[a] < key[b]; });
+
+    std::vector<unsigned long> oldToNew(nEdge);
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) oldToNew[newToOld[iEdge]] = iEdge;
+
+    /*--- Renumber the edges and the point-to-edge map. ---*/
+    edges->Renumber(newToOld);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); ++iNode) {
+        const auto iEdge = nodes->GetEdge(iPoint, iNode);
+        if (iEdge >= 0) nodes->SetEdge(iPoint, oldToNew[iEdge], iNode);
+      }
+    }
+  }
+
+  if (!benchmark) return;
+
+  passivedouble timeOrdered = 0.0;
+  const auto missesOrdered = benchmarkEdgeLoop(*edges, nEdge, nPoint, timeOrdered);
+
+  /*--- Edges and misses are summed over the ranks, the time is the slowest rank. ---*/
+  unsigned long localCounts[] = {nEdge, missesNatural, missesOrdered}, globalCounts[3] = {0};
+  passivedouble localTimes[] = {timeNatural, timeOrdered}, globalTimes[2] = {0.0};
+  SU2_MPI::Allreduce(localCounts, globalCounts, 3, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(localTimes, globalTimes, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    const auto edgesPerRank = passivedouble(globalCounts[0]) / size;
+    auto report = [&](const char* name, passivedouble time, unsigned long misses) {
+      cout << "  MG level " << MGLevel << ", " << name << ": " << edgesPerRank / max(time, passivedouble(1e-12)) << " edges/s per rank, "
+           << passivedouble(misses) / max(globalCounts[0], 1ul) << " estimated cache misses per edge." << endl;
+    };
+    cout << "Edge loop benchmark on MG level " << MGLevel << " (model loop, 5 variables per point):" << endl;
+    report("Natural ordering", globalTimes[0], globalCounts[1]);
+    report("Final ordering  ", globalTimes[1], globalCounts[2]);
+  }
+}
+
 void CGeometry::SetFaces() {
   //  unsigned long iPoint, jPoint, iFace;
   //  unsigned short jNode, iNode;
@@ -3958,10 +4115,103 @@ const CGeometry::CLineletInfo& CGeometry::GetLineletInfo(const CConfig* config)
   return li;
 }
 
-void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container) {
+namespace {
+
+/*--- Wall distance cache, one file per zone (and time instance) storing for each point of each rank
+ * the distance and the closest wall element (as naturally aligned arrays). The key of each rank is a
+ * hash of the viscous walls of all zones and of the coordinates of its points, i.e. it changes with the
+ * mesh and partitioning. ---*/
+
+constexpr size_t wallDistanceBytesPerPoint =
+    sizeof(passivedouble) + sizeof(int) + 2 * sizeof(unsigned short) + sizeof(unsigned long);
+
+string WallDistanceCacheFile(const CConfig* config, int iInst) {
+  string name = config->GetPartition_WallDist_Cache_FileName() + "_walldistance";
+  if (config->GetnTimeInstances() > 1) name += "_" + to_string(iInst);
+  return config->GetMultizone_FileName(name, config->GetiZone(), ".dat");
+}
+
+uint64_t WallDistanceCacheKey(const CConfig* const* config_container, const CGeometry* geometry) {
+  const int nZone = config_container[ZONE_0]->GetnZone();
+  uint64_t key = CCacheFile::Hash(&nZone, sizeof(int));
+  for (int iZone = 0; iZone < nZone; iZone++) {
+    const auto* config = config_container[iZone];
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+      if (!config->GetViscous_Wall(iMarker)) continue;
+      const auto& tag = config->GetMarker_All_TagBound(iMarker);
+      key = CCacheFile::Hash(tag.data(), tag.size(), key);
+    }
+  }
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
+    for (unsigned short iDim = 0; iDim < geometry->GetnDim(); ++iDim) {
+      const passivedouble coord = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+      key = CCacheFile::Hash(&coord, sizeof(coord), key);
+    }
+  }
+  return key;
+}
+
+bool ReadWallDistanceCache(const CConfig* const* config_container, CGeometry**** geometry_container, int iInst,
+                           const vector<bool>& wallDistanceNeeded) {
+  bool cached = false;
+
+  for (size_t iZone = 0; iZone < wallDistanceNeeded.size(); iZone++) {
+    if (!wallDistanceNeeded[iZone]) continue;
+    const auto* config = config_container[iZone];
+    CGeometry* geometry = geometry_container[iZone][iInst][MESH_0];
+    const auto nPoint = geometry->GetnPoint();
+
+    vector<char> data(nPoint * wallDistanceBytesPerPoint);
+    if (!CCacheFile::Read(WallDistanceCacheFile(config, iInst), iInst,
+                              WallDistanceCacheKey(config_container, geometry), data)) {
+      return false;
+    }
+    const auto* dist = reinterpret_cast<const passivedouble*>(data.data());
+    const auto* rankID = reinterpret_cast<const int*>(dist + nPoint);
+    const auto* zoneID = reinterpret_cast<const unsigned short*>(rankID + nPoint);
+    const auto* markerID = zoneID + nPoint;
+    const auto* elemID = reinterpret_cast<const unsigned long*>(markerID + nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      geometry->nodes->SetWall_Distance(iPoint, dist[iPoint], rankID[iPoint], zoneID[iPoint], markerID[iPoint],
+                                        elemID[iPoint]);
+    }
+    cached = true;
+  }
+  return cached;
+}
+
+void WriteWallDistanceCache(const CConfig* const* config_container, CGeometry**** geometry_container, int iInst,
+                            const vector<bool>& wallDistanceNeeded) {
+  for (size_t iZone = 0; iZone < wallDistanceNeeded.size(); iZone++) {
+    if (!wallDistanceNeeded[iZone]) continue;
+    const auto* config = config_container[iZone];
+    const CGeometry* geometry = geometry_container[iZone][iInst][MESH_0];
+    const auto nPoint = geometry->GetnPoint();
+
+    vector<char> data(nPoint * wallDistanceBytesPerPoint);
+    auto* dist = reinterpret_cast<passivedouble*>(data.data());
+    auto* rankID = reinterpret_cast<int*>(dist + nPoint);
+    auto* zoneID = reinterpret_cast<unsigned short*>(rankID + nPoint);
+    auto* markerID = zoneID + nPoint;
+    auto* elemID = reinterpret_cast<unsigned long*>(markerID + nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      dist[iPoint] = SU2_TYPE::GetValue(geometry->nodes->GetWall_Distance(iPoint));
+      geometry->nodes->GetClosestWall(iPoint, rankID[iPoint], zoneID[iPoint], markerID[iPoint], elemID[iPoint]);
+    }
+    CCacheFile::Write(WallDistanceCacheFile(config, iInst), iInst,
+                          WallDistanceCacheKey(config_container, geometry), data);
+  }
+}
+
+}  // namespace
+
+void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container,
+                                    bool allowCache) {
   int nZone = config_container[ZONE_0]->GetnZone();
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
+  const bool useCache = allowCache && config_container[ZONE_0]->GetPartition_WallDist_Cache();
+  const bool distributed = config_container[ZONE_0]->GetWallDistance_Distributed();
 
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++) {
     for (int iZone = 0; iZone < nZone; iZone++) {
@@ -3981,8 +4231,32 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
       if (wallDistanceNeeded[iZone]) geometry->SetWallDistance(numeric_limits<su2double>::max());
     }
 
+    const bool cached = useCache && ReadWallDistanceCache(config_container, geometry_container, iInst,
+                                                          wallDistanceNeeded);
+    if (cached) {
+      allEmpty = false;
+      if (SU2_MPI::GetRank() == MASTER_NODE) cout << "Wall distance read from the cache." << endl;
+    }
+
+    /*--- Distributed variant, each rank only builds the ADT of its own walls and the search is collective. ---*/
+    for (int iZone = 0; iZone < nZone && !cached && distributed; iZone++) {
+      unique_ptr<CADTElemClass> WallADT =
+          geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone], false);
+      if (!WallADT) continue;
+
+      int localEmpty = WallADT->IsEmpty(), globalEmpty = localEmpty;
+      SU2_MPI::Allreduce(&localEmpty, &globalEmpty, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+      if (globalEmpty) continue;
+
+      allEmpty = false;
+      for (int jZone = 0; jZone < nZone; jZone++) {
+        if (wallDistanceNeeded[jZone])
+          geometry_container[jZone][iInst][MESH_0]->SetWallDistanceDistributed(WallADT.get(), iZone);
+      }
+    }
+
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
-    for (int iZone = 0; iZone < nZone; iZone++) {
+    for (int iZone = 0; iZone < nZone && !cached && !distributed; iZone++) {
       unique_ptr<CADTElemClass> WallADT =
           geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
       if (WallADT && !WallADT->IsEmpty()) {
@@ -3996,6 +4270,11 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
       }
     }
 
+    /*--- The cache is only written if there are viscous walls. ---*/
+    if (useCache && !cached && !allEmpty) {
+      WriteWallDistanceCache(config_container, geometry_container, iInst, wallDistanceNeeded);
+    }
+
     /*--- If there are no viscous walls in the entire domain, set distances to zero ---*/
     if (allEmpty) {
       for (int iZone = 0; iZone < nZone; iZone++) {
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/geometry/CPhysicalGeometry.hpp"
+#include "../../include/toolboxes/CCacheFile.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
@@ -35,6 +36,7 @@
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../../include/geometry/primal_grid/CPrimalGrid.hpp"
 #include "../../include/geometry/primal_grid/CLine.hpp"
@@ -51,6 +53,8 @@
 #include <iterator>
 #include <unordered_set>
 #include <queue>
+#include <numeric>
+#include <cstdint>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -98,6 +102,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
       case CGNS_GRID:
       case RECTANGLE:
       case BOX:
+      case SU2_BINARY:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -3476,6 +3481,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
     case BOX:
       MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     default:
       SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
       break;
@@ -4535,6 +4543,126 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
     Result.push_back(iPoint);
   }
 
+  SetPoint_Ordering(Result, config);
+}
+
+namespace {
+/*!
+ * \brief Index along a space-filling curve of integer coordinates with nBits per dimension.
+ * \note The Hilbert transform is J. Skilling's (AIP Conf. Proc. 707, 2004), it converts the
+ *       coordinates to the "transposed" Hilbert index, which is then interleaved as a Morton code.
+ */
+uint64_t spaceFillingCurveIndex(uint32_t* X, unsigned short nDim, unsigned short nBits, bool hilbert) {
+  if (hilbert) {
+    const uint32_t M = 1u << (nBits - 1);
+
+    /*--- Inverse undo. ---*/
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+      const uint32_t P = Q - 1;
+      for (unsigned short i = 0; i < nDim; ++i) {
+        if (X[i] & Q) {
+          X[0] ^= P;
+        } else {
+          const uint32_t t = (X[0] ^ X[i]) & P;
+          X[0] ^= t;
+          X[i] ^= t;
+        }
+      }
+    }
+    /*--- Gray encode. ---*/
+    for (unsigned short i = 1; i < nDim; ++i) X[i] ^= X[i - 1];
+    uint32_t t = 0;
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+      if (X[nDim - 1] & Q) t ^= Q - 1;
+    }
+    for (unsigned short i = 0; i < nDim; ++i) X[i] ^= t;
+  }
+
+  /*--- Interleave the bits, most significant first. ---*/
+  uint64_t index = 0;
+  for (int iBit = nBits - 1; iBit >= 0; --iBit) {
+    for (unsigned short i = 0; i < nDim; ++i) index = (index << 1) | ((X[i] >> iBit) & 1u);
+  }
+  return index;
+}
+
+/*!
+ * \brief Sort "items" along a space-filling curve through the bounding box of their coordinates.
+ * \param[in] nItem - Number of items to sort.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] hilbert - Hilbert curve if true, Morton curve otherwise.
+ * \param[in] getCoord - Functor returning coordinate iDim of item i.
+ * \return The items in curve order (new to old index).
+ */
+template <class F>
+vector<unsigned long> sortAlongCurve(unsigned long nItem, unsigned short nDim, bool hilbert, const F& getCoord) {
+  /*--- Number of bits per dimension such that the index fits in 64 bits. ---*/
+  const unsigned short nBits = (nDim == 3) ? 21 : 31;
+  const auto nCells = passivedouble((1ul << nBits) - 1);
+
+  passivedouble minCoord[3], maxCoord[3];
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    minCoord[iDim] = std::numeric_limits<passivedouble>::max();
+    maxCoord[iDim] = std::numeric_limits<passivedouble>::lowest();
+  }
+  for (auto i = 0ul; i < nItem; ++i) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      minCoord[iDim] = min(minCoord[iDim], getCoord(i, iDim));
+      maxCoord[iDim] = max(maxCoord[iDim], getCoord(i, iDim));
+    }
+  }
+
+  /*--- Use the same scale in all directions to preserve the aspect ratio of the domain. ---*/
+  passivedouble range = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) range = max(range, maxCoord[iDim] - minCoord[iDim]);
+  const passivedouble scale = (range > 0.0) ? nCells / range : 0.0;
+
+  vector<uint64_t> key(nItem);
+  for (auto i = 0ul; i < nItem; ++i) {
+    uint32_t X[3] = {0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const auto x = (getCoord(i, iDim) - minCoord[iDim]) * scale;
+      X[iDim] = static_cast<uint32_t>(min(max(x, 0.0), nCells));
+    }
+    key[i] = spaceFillingCurveIndex(X, nDim, nBits, hilbert);
+  }
+
+  vector<unsigned long> order(nItem);
+  iota(order.begin(), order.end(), 0ul);
+  stable_sort(order.begin(), order.end(), [&key](unsigned long a, unsigned long b) { return key[a] < key[b]; });
+  return order;
+}
+}  // namespace
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig* config) {
+  const bool hilbert = config->GetKind_Point_Ordering() == POINT_ORDERING::HILBERT;
+
+  /*--- Order the domain points along the curve, halo points are kept at the end. ---*/
+  auto Result = sortAlongCurve(nPointDomain, nDim, hilbert, [&](unsigned long iPoint, unsigned short iDim) {
+    return SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+  });
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    Result.push_back(iPoint);
+  }
+
+  /*--- Order the elements along the same curve using the average of their nodes. The
+   *    elements surrounding points are reset by SetPoint_Ordering. ---*/
+  const auto elemOrder = sortAlongCurve(nElem, nDim, hilbert, [&](unsigned long iElem, unsigned short iDim) {
+    passivedouble x = 0.0;
+    for (auto iNode = 0u; iNode < elem[iElem]->GetnNodes(); iNode++) {
+      x += SU2_TYPE::GetValue(nodes->GetCoord(elem[iElem]->GetNode(iNode), iDim));
+    }
+    return x / elem[iElem]->GetnNodes();
+  });
+  vector<CPrimalGrid*> auxElem(elem, elem + nElem);
+  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+    elem[iElem] = auxElem[elemOrder[iElem]];
+  }
+
+  SetPoint_Ordering(Result, config);
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(const vector<unsigned long>& Result, const CConfig* config) {
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -7059,15 +7187,37 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
     END_SU2_OMP_FOR
   }
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { /*--- The following is difficult to parallelize with threads. ---*/
+  /*--- Elements of the same color have no common points, and therefore no common edges, so
+   the dual volumes and normals can be accumulated by several threads without conflicts. When
+   running with one thread the coloring is natural (a single color), i.e. the serial order. ---*/
+  static su2double DomainVolume; /*--- Shared by the threads. ---*/
 
-    su2double my_DomainVolume = 0.0;
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    GetElementColoring();
+    DomainVolume = 0.0;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  const auto& coloring = GetElementColoring();
+
+  /*--- Preaccumulation is not thread-safe. ---*/
+  const bool preacc = (omp_get_num_threads() == 1);
+
+  su2double my_DomainVolume = 0.0;
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+    const auto* colorElems = coloring.innerIdx(iColor);
+    const auto colorSize = coloring.getNumNonZeros(iColor);
+
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, GetElementColorGroupSize()))
+    for (auto k = 0ul; k < colorSize; ++k) {
+      const auto iElem = colorElems[k];
       const auto nNodes = elem[iElem]->GetnNodes();
 
       /*--- To make preaccumulation more effective, use as few inputs
        as possible, recomputing intermediate quantities as needed. ---*/
-      AD::StartPreacc();
+      if (preacc) AD::StartPreacc();
 
       /*--- Get pointers to the coordinates of all the element nodes ---*/
       array<const su2double*, N_POINTS_MAXIMUM> Coord;
@@ -7176,14 +7326,19 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
 #endif
       AD::EndPreacc();
     }
+    END_SU2_OMP_FOR
+  }
 
-    su2double DomainVolume;
-    SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    config->SetDomainVolume(DomainVolume);
+  atomicAdd(my_DomainVolume, DomainVolume);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    su2double TotalVolume;
+    SU2_MPI::Allreduce(&DomainVolume, &TotalVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    config->SetDomainVolume(TotalVolume);
 
     if ((rank == MASTER_NODE) && (action == ALLOCATE)) {
-      if (nDim == 2) cout << "Area of the computational grid: " << DomainVolume << "." << endl;
-      if (nDim == 3) cout << "Volume of the computational grid: " << DomainVolume << "." << endl;
+      if (nDim == 2) cout << "Area of the computational grid: " << TotalVolume << "." << endl;
+      if (nDim == 3) cout << "Volume of the computational grid: " << TotalVolume << "." << endl;
     }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
@@ -7750,6 +7905,47 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   METIS_SetDefaultOptions(options);
   options[1] = 0;
 
+  const auto wp = config->GetParMETIS_PointWeight();
+  const auto we = config->GetParMETIS_EdgeWeight();
+
+  /*--- Reuse the partitioning of a previous run if the graph, the coordinates, and the partitioning
+   * parameters are the same on all ranks (the cache is keyed by a hash of these inputs). ---*/
+
+  const bool useCache = config->GetPartition_WallDist_Cache();
+  string cacheFile;
+  uint64_t cacheKey = 0, localKey = 0;
+
+  if (useCache) {
+    cacheFile = config->GetMultizone_FileName(config->GetPartition_WallDist_Cache_FileName() + "_partition",
+                                              config->GetiZone(), ".dat");
+    const passivedouble params[] = {static_cast<passivedouble>(Global_nPointDomain), static_cast<passivedouble>(ubvec),
+                                    static_cast<passivedouble>(wp), static_cast<passivedouble>(we),
+                                    static_cast<passivedouble>(sizeof(idx_t))};
+    cacheKey = CCacheFile::Hash(params, sizeof(params));
+
+    localKey = CCacheFile::Hash(xadj.data(), xadj.size() * sizeof(idx_t));
+    localKey = CCacheFile::Hash(adjacency.data(), adjacency.size() * sizeof(idx_t), localKey);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble coord = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+        localKey = CCacheFile::Hash(&coord, sizeof(coord), localKey);
+      }
+    }
+
+    vector<char> cached(nPoint * sizeof(idx_t));
+    if (CCacheFile::Read(cacheFile, cacheKey, localKey, cached)) {
+      if (rank == MASTER_NODE) cout << "Graph partitioning read from " << cacheFile << "." << endl;
+
+      const auto* part = reinterpret_cast<const idx_t*>(cached.data());
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        nodes->SetColor(iPoint, part[iPoint]);
+      }
+      decltype(xadj)().swap(xadj);
+      decltype(adjacency)().swap(adjacency);
+      return;
+    }
+  }
+
   /*--- Fill the necessary ParMETIS input data arrays. ---*/
 
   vector<real_t> tpwgts(size, 1.0 / size);
@@ -7766,9 +7962,6 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
    * and number of edges (or neighbors) per point, giving more importance to the latter
    * skews the partitioner towards evenly distributing the total number of edges. ---*/
 
-  const auto wp = config->GetParMETIS_PointWeight();
-  const auto we = config->GetParMETIS_EdgeWeight();
-
   vector<idx_t> vwgt(nPoint);
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
     vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
@@ -7798,6 +7991,12 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
+  if (useCache) {
+    vector<char> cached(nPoint * sizeof(idx_t));
+    memcpy(cached.data(), part.data(), cached.size());
+    CCacheFile::Write(cacheFile, cacheKey, localKey, cached);
+  }
+
   /*--- Force free the connectivity. ---*/
 
   decltype(xadj)().swap(xadj);
@@ -10500,7 +10699,7 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig* config, bool original_surface,
   delete[] Twist;
 }
 
-std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig* config) const {
+std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig* config, bool globalTree) const {
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -10575,7 +10774,7 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*--------------------------------------------------------------------------*/
 
   std::unique_ptr<CADTElemClass> WallADT(
-      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, true));
+      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, globalTree));
 
   return WallADT;
 }
@@ -10621,3 +10820,32 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
 
 #undef CPHYSGEO_PARFOR
 #undef END_CPHYSGEO_PARFOR
+
+void CPhysicalGeometry::SetWallDistanceDistributed(CADTElemClass* WallADT, unsigned short iZone) {
+  vector<su2double> coor(nPoint * nDim);
+  vector<int> rankHint(nPoint, -1);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) coor[iPoint * nDim + iDim] = nodes->GetCoord(iPoint, iDim);
+
+    int rankID;
+    unsigned short zoneID, markerID;
+    unsigned long elemID;
+    nodes->GetClosestWall(iPoint, rankID, zoneID, markerID, elemID);
+    if (zoneID == iZone) rankHint[iPoint] = rankID;
+  }
+
+  vector<su2double> dist(nPoint);
+  vector<unsigned short> markerID(nPoint);
+  vector<unsigned long> elemID(nPoint);
+  vector<int> rankID(nPoint);
+
+  WallADT->DetermineNearestElementDistributed(nPoint, coor.data(), rankHint.data(), dist.data(), markerID.data(),
+                                              elemID.data(), rankID.data());
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    if (rankID[iPoint] >= 0 && dist[iPoint] < nodes->GetWall_Distance(iPoint)) {
+      nodes->SetWall_Distance(iPoint, dist[iPoint], rankID[iPoint], iZone, markerID[iPoint], elemID[iPoint]);
+    }
+  }
+}
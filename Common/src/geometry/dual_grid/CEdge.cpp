@@ -40,6 +40,21 @@ CEdge::CEdge(unsigned long nEdge_, unsigned long nDim)
 
 void CEdge::SetZeroValues() { Normal = su2double(0.0); }
 
+void CEdge::Renumber(const std::vector<unsigned long>& newToOld) {
+  assert(newToOld.size() == nEdge);
+
+  const NodeArray oldNodes = Nodes;
+  const su2activematrix oldNormal = Normal;
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto jEdge = newToOld[iEdge];
+    Nodes(iEdge, LEFT) = oldNodes(jEdge, LEFT);
+    Nodes(iEdge, RIGHT) = oldNodes(jEdge, RIGHT);
+    for (auto iDim = 0ul; iDim < Normal.cols(); ++iDim) Normal(iEdge, iDim) = oldNormal(jEdge, iDim);
+  }
+  SetPaddingNodes();
+}
+
 su2double CEdge::GetVolume(const su2double* coord_Edge_CG, const su2double* coord_FaceElem_CG,
                            const su2double* coord_Elem_CG, const su2double* coord_Point) {
   constexpr unsigned long nDim = 3;
@@ -59,6 +59,11 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig* val_config, unsigned short val_i
   }
 
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
+#ifdef SU2_CGNS_PARALLEL
+  if (parallelIO) {
+    if (cgp_close(cgnsFileID)) cgp_error_exit();
+  } else
+#endif
   if (cg_close(cgnsFileID)) cg_error_exit();
 
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
@@ -90,10 +95,22 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(const string& val_filename) {
    is the specific index number for this file and will be
    repeatedly used in the function calls. ---*/
 
+  parallelIO = CanReadInParallel(val_filename, file_type);
+
+#ifdef SU2_CGNS_PARALLEL
+  if (parallelIO) {
+    /*--- All ranks open the file through parallel HDF5, the data is then read with
+     collective hyperslab reads of the linear partitions. ---*/
+    if (cgp_mpi_comm(SU2_MPI::GetComm()) || cgp_pio_mode(CGP_COLLECTIVE)) cgp_error_exit();
+    if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cgp_error_exit();
+  } else
+#endif
   if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cg_error_exit();
   if (rank == MASTER_NODE) {
     cout << "Reading the CGNS file: ";
-    cout << val_filename.c_str() << "." << endl;
+    cout << val_filename.c_str();
+    if (parallelIO) cout << " (parallel HDF5)";
+    cout << "." << endl;
   }
   if (cg_version(cgnsFileID, &file_version)) cg_error_exit();
   if (rank == MASTER_NODE) {
@@ -105,6 +122,37 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(const string& val_filename) {
   }
 }
 
+bool CCGNSMeshReaderFVM::CanReadInParallel(const string& val_filename, int file_type) const {
+#ifdef SU2_CGNS_PARALLEL
+  if (size == SINGLE_NODE || file_type != CG_FILE_HDF5) return false;
+
+  /*--- The parallel API has no partial reads of variable size element sections. ---*/
+
+  int fixedSize = 1;
+  if (rank == MASTER_NODE) {
+    int fileID, nsections;
+    if (cg_open(val_filename.c_str(), CG_MODE_READ, &fileID)) cg_error_exit();
+    if (cg_nsections(fileID, cgnsBase, cgnsZone, &nsections)) cg_error_exit();
+
+    for (int s = 0; s < nsections; s++) {
+      int nbndry, parent_flag;
+      cgsize_t startE, endE;
+      ElementType_t elemType;
+      char sectionName[CGNS_STRING_SIZE];
+      if (cg_section_read(fileID, cgnsBase, cgnsZone, s + 1, sectionName, &elemType, &startE, &endE, &nbndry,
+                          &parent_flag))
+        cg_error_exit();
+      if (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n) fixedSize = 0;
+    }
+    if (cg_close(fileID)) cg_error_exit();
+  }
+  SU2_MPI::Bcast(&fixedSize, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  return fixedSize != 0;
+#else
+  return false;
+#endif
+}
+
 void CCGNSMeshReaderFVM::ReadCGNSDatabaseMetadata() {
   /*--- Get the number of databases. This is the highest node
    in the CGNS heirarchy. ---*/
@@ -266,6 +314,17 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
 
+#ifdef SU2_CGNS_PARALLEL
+    if (parallelIO) {
+      /*--- Collective read, ranks without points still participate. ---*/
+      const cgsize_t memSize = numberOfLocalPoints, memMin = 1, memMax = numberOfLocalPoints;
+      void* buf = (numberOfLocalPoints > 0) ? localPointCoordinates[indC].data() : nullptr;
+      if (cgp_coord_general_read_data(cgnsFileID, cgnsBase, cgnsZone, k + 1, &range_min, &range_max, RealDouble, 1,
+                                      &memSize, &memMin, &memMax, buf))
+        cgp_error_exit();
+      continue;
+    }
+#endif
     if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble, &range_min, &range_max,
                       localPointCoordinates[indC].data()))
       cg_error_exit();
@@ -422,7 +481,11 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    number of elements on this rank. ---*/
 
   cgsize_t sizeNeeded = 0, sizeOffset = 0;
-  if (nElems[val_section] > 0) {
+  if (parallelIO) {
+    /*--- Only fixed size sections in this case. ---*/
+    if (cg_npe(elemType, &npe)) cg_error_exit();
+    sizeNeeded = nElems[val_section] * npe;
+  } else if (nElems[val_section] > 0) {
     if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank), &sizeNeeded) != CG_OK)
@@ -443,6 +506,16 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    partial read function in the CGNS API. Only call the CGNS API
    if we have a non-zero number of elements on this rank. ---*/
 
+#ifdef SU2_CGNS_PARALLEL
+  if (parallelIO) {
+    /*--- Collective hyperslab read of the linear partition of the section. ---*/
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
+                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
+                               (nElems[val_section] > 0) ? connElemCGNS.data() : nullptr))
+      cgp_error_exit();
+  } else
+#endif
   if (nElems[val_section] > 0) {
     if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
@@ -779,6 +852,25 @@ void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
   ElementType_t elemType;
   char sectionName[CGNS_STRING_SIZE];
 
+  /*--- With parallel IO all ranks take part in the (collective) read,
+   but only the master rank requests the data. ---*/
+
+  vector<cgsize_t> connElemParallel;
+#ifdef SU2_CGNS_PARALLEL
+  if (parallelIO) {
+    if (cg_section_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1, sectionName, &elemType, &startE, &endE,
+                        &nbndry, &parent_flag))
+      cg_error_exit();
+    if (rank == MASTER_NODE) {
+      if (cg_ElementDataSize(cgnsFileID, cgnsBase, cgnsZone, val_section + 1, &ElementDataSize)) cg_error_exit();
+      connElemParallel.resize(ElementDataSize);
+    }
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section + 1, startE, endE,
+                               (rank == MASTER_NODE) ? connElemParallel.data() : nullptr))
+      cgp_error_exit();
+  }
+#endif
+
   if (rank == MASTER_NODE) {
     /*--- Allocate some memory for the handling the connectivity
      and auxiliary data that we are need to communicate. ---*/
@@ -825,16 +917,20 @@ void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
     /*--- Allocate memory for accessing the connectivity and to
      store it in the proper data structure for post-processing. ---*/
 
-    vector<cgsize_t> connElemTemp(ElementDataSize, 0);
+    vector<cgsize_t> connElemTemp;
 
     /*--- Retrieve the connectivity information and store. ---*/
 
-    if (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n) {
+    if (parallelIO) {
+      connElemTemp = std::move(connElemParallel);
+    } else if (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n) {
+      connElemTemp.resize(ElementDataSize, 0);
       vector<cgsize_t> connOffsetTemp(nElems[val_section] + 1, 0);
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1, startE, endE,
                                         connElemTemp.data(), connOffsetTemp.data(), nullptr) != CG_OK)
         cg_error_exit();
     } else {
+      connElemTemp.resize(ElementDataSize, 0);
       if (cg_elements_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1, connElemTemp.data(), nullptr))
         cg_error_exit();
     }
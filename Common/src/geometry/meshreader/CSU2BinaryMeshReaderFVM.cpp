@@ -0,0 +1,335 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+using namespace SU2BinaryMesh;
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  /*--- The binary format stores one zone per file, and the actuator disk splitting of the
+   ASCII reader is not available (the split mesh can be written with OUTPUT_FILES= MESH_BINARY). ---*/
+
+  if (config->GetMultizone_Mesh() && val_nZone > 1) {
+    SU2_MPI::Error(
+        "SU2 binary meshes contain a single zone.\n"
+        "Use one mesh file per zone (MULTIZONE_MESH= NO).",
+        CURRENT_FUNCTION);
+  }
+  const bool actuator_disk =
+      ((config->GetnMarker_ActDiskInlet() != 0) || (config->GetnMarker_ActDiskOutlet() != 0)) &&
+      ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) ||
+       ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) && (config->GetActDisk_SU2_DEF()))) &&
+      !config->GetActDisk_DoubleSurface();
+  if (actuator_disk) {
+    SU2_MPI::Error(
+        "Splitting actuator disk surfaces is not supported with SU2 binary meshes.\n"
+        "Convert a mesh where the actuator disk is already split.",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- Open the file on all ranks. ---*/
+
+#ifdef HAVE_MPI
+  const bool fail = MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL,
+                                  &fileHandle) != MPI_SUCCESS;
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  const bool fail = (fileHandle == nullptr);
+#endif
+  if (fail) {
+    SU2_MPI::Error(
+        "Error opening SU2 binary grid.\n"
+        "Check that the file exists.",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- Every rank reads only its linear partition of points and elements,
+   the markers are small and read by the master then broadcast. ---*/
+
+  ReadMetadata();
+
+  ReadPointCoordinates();
+
+  ReadVolumeElementConnectivity();
+
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+}
+
+void CSU2BinaryMeshReaderFVM::ReadAll(unsigned long offset, void* data, unsigned long sizeInBytes) {
+  auto* bytes = static_cast<char*>(data);
+
+#ifdef HAVE_MPI
+  /*--- MPI counts are int, large blocks are read in chunks. All ranks need to take part
+   in the same number of collective calls, even if they have nothing (left) to read. ---*/
+
+  constexpr unsigned long maxChunkSize = 1ul << 30;
+  const unsigned long nChunks = (sizeInBytes + maxChunkSize - 1) / maxChunkSize;
+  unsigned long maxChunks = 0;
+  SU2_MPI::Allreduce(&nChunks, &maxChunks, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  for (unsigned long iChunk = 0; iChunk < maxChunks; ++iChunk) {
+    const auto begin = min(iChunk * maxChunkSize, sizeInBytes);
+    const auto count = min(maxChunkSize, sizeInBytes - begin);
+
+    MPI_Status status;
+    MPI_File_read_at_all(fileHandle, offset + begin, bytes + begin, static_cast<int>(count), MPI_BYTE, &status);
+
+    int nRead = 0;
+    MPI_Get_count(&status, MPI_BYTE, &nRead);
+    if (static_cast<unsigned long>(nRead) != count) {
+      SU2_MPI::Error("Unexpected end of SU2 binary grid, the file may be truncated.", CURRENT_FUNCTION);
+    }
+  }
+#else
+  if (sizeInBytes == 0) return;
+
+  if (fseek(fileHandle, offset, SEEK_SET) != 0 || fread(bytes, 1, sizeInBytes, fileHandle) != sizeInBytes) {
+    SU2_MPI::Error("Unexpected end of SU2 binary grid, the file may be truncated.", CURRENT_FUNCTION);
+  }
+#endif
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  /*--- Only the master reads the magic string and the header, other ranks take
+   part in the collective read with an empty block. ---*/
+
+  char buffer[magicSize + HEADER_SIZE * sizeof(int64_t)] = {0};
+  ReadAll(0, buffer, (rank == MASTER_NODE) ? sizeof(buffer) : 0);
+  SU2_MPI::Bcast(buffer, sizeof(buffer), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (strncmp(buffer, magic, magicSize) != 0) {
+    SU2_MPI::Error(
+        "File " + meshFilename +
+            " is not an SU2 binary grid.\n"
+            "Check that MESH_FORMAT matches the file (SU2 for ASCII meshes).",
+        CURRENT_FUNCTION);
+  }
+  memcpy(header, buffer + magicSize, sizeof(header));
+
+  dimension = header[NDIME];
+  numberOfGlobalPoints = header[NPOIN];
+  numberOfGlobalElements = header[NELEM];
+  numberOfMarkers = header[NMARK];
+
+  if ((dimension != 2 && dimension != 3) || header[NPOIN] <= 0 || header[NELEM] <= 0 || header[NMARK] < 0) {
+    SU2_MPI::Error("Invalid header in SU2 binary grid, the file may be corrupted.", CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  /* Determine number of local points */
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const auto firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- The points are stored contiguously (point-major), read our slice and transpose it. ---*/
+
+  vector<double> coords(numberOfLocalPoints * dimension);
+  ReadAll(header[POINTS_OFFSET] + firstPoint * dimension * sizeof(double), coords.data(),
+          coords.size() * sizeof(double));
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+      localPointCoordinates[iDim][iPoint] = coords[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /* Get partitioners to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements, 0);
+
+  const auto firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const auto nElemRead = elemPartitioner.GetSizeOnRank(rank);
+
+  /*--- Read the index of our linear partition of elements, and then the
+   corresponding (contiguous) block of the connectivity. ---*/
+
+  vector<int64_t> elemIndex(nElemRead + 1);
+  ReadAll(header[ELEM_INDEX_OFFSET] + firstElem * sizeof(int64_t), elemIndex.data(),
+          elemIndex.size() * sizeof(int64_t));
+
+  vector<int64_t> conn(elemIndex.back() - elemIndex.front());
+  ReadAll(header[ELEM_CONN_OFFSET] + elemIndex.front() * sizeof(int64_t), conn.data(), conn.size() * sizeof(int64_t));
+
+  /*--- Send each element to every rank that owns at least one of its nodes (i.e., there will
+   be element redundancy, since multiple ranks will store the same elems on the boundaries of
+   the initial linear partitioning), this is what the ASCII reader stores on each rank. ---*/
+
+  vector<vector<unsigned long> > sendBuffer(size);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const int64_t* elem = &conn[elemIndex[iElem] - elemIndex.front()];
+    const auto VTK_Type = static_cast<unsigned short>(elem[0]);
+    const auto nPointsElem = nPointsOfElementType(VTK_Type);
+
+    if (nPointsElem == 0 || elemIndex[iElem + 1] - elemIndex[iElem] != nPointsElem + 1) {
+      SU2_MPI::Error("Invalid volume element in SU2 binary grid, the file may be corrupted.", CURRENT_FUNCTION);
+    }
+
+    array<int, N_POINTS_HEXAHEDRON> destinations{};
+    unsigned short nDestinations = 0;
+
+    for (unsigned short i = 0; i < nPointsElem; i++) {
+      if (elem[i + 1] < 0 || static_cast<unsigned long>(elem[i + 1]) >= numberOfGlobalPoints) {
+        SU2_MPI::Error("Volume element with invalid point index in SU2 binary grid.", CURRENT_FUNCTION);
+      }
+      const int iRank = pointPartitioner.GetRankContainingIndex(elem[i + 1]);
+      bool found = false;
+      for (unsigned short j = 0; j < nDestinations; j++) found |= (destinations[j] == iRank);
+      if (!found) destinations[nDestinations++] = iRank;
+    }
+
+    for (unsigned short j = 0; j < nDestinations; j++) {
+      auto& buffer = sendBuffer[destinations[j]];
+      buffer.push_back(firstElem + iElem);
+      buffer.push_back(VTK_Type);
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
+        buffer.push_back((i < nPointsElem) ? elem[i + 1] : 0);
+      }
+    }
+  }
+  conn.clear();
+
+  /*--- Exchange the sizes, and then the elements. ---*/
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuffer[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> sendData(sendDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++) {
+    copy(sendBuffer[iRank].begin(), sendBuffer[iRank].end(), sendData.begin() + sendDispl[iRank]);
+    vector<unsigned long>().swap(sendBuffer[iRank]);
+  }
+
+  /*--- Elements are received in order of rank, i.e. sorted by global index. ---*/
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+
+  SU2_MPI::Alltoallv(sendData.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  numberOfLocalElements = localVolumeElementConnectivity.size() / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The master reads the marker section and broadcasts it, the boundary
+   info is then parsed by all ranks (as with the ASCII reader). ---*/
+
+  const auto markersSize = static_cast<unsigned long>(header[MARKERS_SIZE]);
+  vector<char> markers(markersSize);
+  ReadAll(header[MARKERS_OFFSET], markers.data(), (rank == MASTER_NODE) ? markersSize : 0);
+
+  /*--- MPI counts are int, large sections are broadcast in chunks (as in ReadAll). ---*/
+  constexpr unsigned long maxChunkSize = 1ul << 30;
+  for (unsigned long begin = 0; begin < markersSize; begin += maxChunkSize) {
+    const auto count = min(maxChunkSize, markersSize - begin);
+    SU2_MPI::Bcast(markers.data() + begin, static_cast<int>(count), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+  }
+
+  const char* pos = markers.data();
+  const char* const end = pos + markersSize;
+
+  auto readInt = [&]() {
+    if (pos + sizeof(int64_t) > end) {
+      SU2_MPI::Error("Unexpected end of the markers in SU2 binary grid.", CURRENT_FUNCTION);
+    }
+    int64_t value;
+    memcpy(&value, pos, sizeof(int64_t));
+    pos += sizeof(int64_t);
+    return value;
+  };
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; ++iMarker) {
+    const auto nElem_Bound = readInt();
+    const auto nameLength = readInt();
+
+    if (nElem_Bound < 0 || nameLength < 0 || pos + nameLength > end) {
+      SU2_MPI::Error("Invalid marker in SU2 binary grid, the file may be corrupted.", CURRENT_FUNCTION);
+    }
+    markerNames[iMarker].assign(pos, nameLength);
+    pos += nameLength;
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(
+          "Mesh file contains deprecated SEND_RECEIVE marker!\n"
+          "Please remove any SEND_RECEIVE markers from the SU2 binary mesh.",
+          CURRENT_FUNCTION);
+    }
+
+    auto& connectivity = surfaceElementConnectivity[iMarker];
+    connectivity.reserve(nElem_Bound * SU2_CONN_SIZE);
+
+    for (int64_t iElem_Bound = 0; iElem_Bound < nElem_Bound; iElem_Bound++) {
+      const auto VTK_Type = static_cast<unsigned short>(readInt());
+
+      if (VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) {
+        SU2_MPI::Error("Invalid surface element in SU2 binary grid, the file may be corrupted.", CURRENT_FUNCTION);
+      }
+      if (dimension == 3 && VTK_Type == LINE) {
+        SU2_MPI::Error(
+            "Line boundary conditions are not possible for 3D calculations.\n"
+            "Please check the SU2 binary mesh file.",
+            CURRENT_FUNCTION);
+      }
+      const auto nPointsElem = nPointsOfElementType(VTK_Type);
+
+      connectivity.push_back(0);
+      connectivity.push_back(VTK_Type);
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
+        connectivity.push_back((i < nPointsElem) ? readInt() : 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,447 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the aggregation-based algebraic multigrid preconditioner.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/linear_algebra/CSysMatrix.inl"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+/*--- Couplings weaker than this (relative to the diagonals) are ignored by the aggregation. ---*/
+constexpr passivedouble AMG_STRENGTH_THRESHOLD = 0.08;
+/*--- Relaxation factor of the block-Jacobi smoother. ---*/
+constexpr passivedouble AMG_RELAXATION = 0.7;
+/*--- Coarsening is considered ineffective if it does not reduce the number of points by this factor. ---*/
+constexpr passivedouble AMG_MIN_COARSENING_RATIO = 1.5;
+}  // namespace
+
+template <class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(unsigned long nPoint, unsigned long nVar,
+                                                         const unsigned long* row_ptr, const unsigned long* col_ind,
+                                                         const unsigned long* dia_ptr, const ScalarType* values,
+                                                         std::vector<unsigned long>& aggregate) {
+  constexpr auto NONE = std::numeric_limits<unsigned long>::max();
+  const auto blkSz = nVar * nVar;
+
+  auto blockNorm = [&](unsigned long index) {
+    passivedouble norm = 0.0;
+    for (auto k = 0ul; k < blkSz; ++k) norm += pow(SU2_TYPE::GetValue(values[index * blkSz + k]), 2);
+    return sqrt(norm);
+  };
+
+  std::vector<passivedouble> diagNorm(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) diagNorm[iPoint] = blockNorm(dia_ptr[iPoint]);
+
+  /*--- Strength of the coupling between iPoint and the column of a block, 0 if weak. ---*/
+  auto strength = [&](unsigned long iPoint, unsigned long index) {
+    const auto jPoint = col_ind[index];
+    if (jPoint == iPoint || jPoint >= nPoint) return 0.0;
+    const passivedouble s = blockNorm(index);
+    return (s >= AMG_STRENGTH_THRESHOLD * sqrt(diagNorm[iPoint] * diagNorm[jPoint])) ? s : 0.0;
+  };
+
+  aggregate.assign(nPoint, NONE);
+  unsigned long nAgg = 0;
+
+  /*--- First pass, points whose strong neighborhood is not yet aggregated become roots of new aggregates. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+
+    bool free = true, isolated = true;
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1] && free; ++k) {
+      if (strength(iPoint, k) == 0.0) continue;
+      isolated = false;
+      free = (aggregate[col_ind[k]] == NONE);
+    }
+    if (!free || isolated) continue;
+
+    aggregate[iPoint] = nAgg;
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k) {
+      if (strength(iPoint, k) > 0.0) aggregate[col_ind[k]] = nAgg;
+    }
+    ++nAgg;
+  }
+
+  /*--- Second pass, the remaining points join the aggregate of the most strongly coupled neighbor.
+   * The aggregates of the first pass are used to avoid chains of points joining each other. ---*/
+
+  const auto firstPass = aggregate;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+
+    passivedouble maxStrength = 0.0;
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k) {
+      const auto s = strength(iPoint, k);
+      if (s > maxStrength && firstPass[col_ind[k]] != NONE) {
+        maxStrength = s;
+        aggregate[iPoint] = firstPass[col_ind[k]];
+      }
+    }
+  }
+
+  /*--- Third pass, what is left forms aggregates with its free strong neighbors, or on its own. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+
+    aggregate[iPoint] = nAgg;
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k) {
+      if (strength(iPoint, k) > 0.0 && aggregate[col_ind[k]] == NONE) aggregate[col_ind[k]] = nAgg;
+    }
+    ++nAgg;
+  }
+
+  return nAgg;
+}
+
+template <class ScalarType>
+bool CAlgebraicMultigrid<ScalarType>::Coarsen(const CSysMatrix<ScalarType>& fine, unsigned long nPoint,
+                                              const unsigned long* row_ptr, const unsigned long* col_ind,
+                                              const unsigned long* dia_ptr, const ScalarType* values,
+                                              CLevel& coarse) {
+  const auto nVar = fine.nVar;
+  const auto blkSz = nVar * nVar;
+
+  std::vector<unsigned long> aggregate;
+  const auto nCoarse = Aggregate(nPoint, nVar, row_ptr, col_ind, dia_ptr, values, aggregate);
+
+  if (nCoarse == 0 || nCoarse * AMG_MIN_COARSENING_RATIO > nPoint) return false;
+
+  coarse.nPoint = nCoarse;
+
+  /*--- Invert the map point -> aggregate into aggregate -> points (a CSR structure). ---*/
+
+  coarse.agg_ptr.assign(nCoarse + 1, 0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) ++coarse.agg_ptr[aggregate[iPoint] + 1];
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) coarse.agg_ptr[iAgg + 1] += coarse.agg_ptr[iAgg];
+
+  coarse.agg_idx.resize(nPoint);
+  {
+    auto pos = coarse.agg_ptr;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) coarse.agg_idx[pos[aggregate[iPoint]]++] = iPoint;
+  }
+
+  /*--- Galerkin product with piecewise constant prolongation, A_IJ = sum_{i in I, j in J} A_ij.
+   * The pattern of each row is the union of the aggregates of the neighbors of its points. ---*/
+
+  constexpr auto NONE = std::numeric_limits<unsigned long>::max();
+  std::vector<unsigned long> position(nCoarse, NONE);
+  std::vector<unsigned long> rowCols;
+
+  coarse.row_ptr.assign(1, 0);
+  coarse.col_ind.clear();
+  coarse.dia_ptr.resize(nCoarse);
+  coarse.matrix.clear();
+
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    rowCols.clear();
+    for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k) {
+      const auto iPoint = coarse.agg_idx[k];
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+        if (col_ind[index] >= nPoint) continue;
+        const auto jAgg = aggregate[col_ind[index]];
+        if (position[jAgg] == NONE) {
+          position[jAgg] = 0;
+          rowCols.push_back(jAgg);
+        }
+      }
+    }
+    std::sort(rowCols.begin(), rowCols.end());
+
+    const auto begin = coarse.col_ind.size();
+    for (auto i = 0ul; i < rowCols.size(); ++i) {
+      position[rowCols[i]] = begin + i;
+      coarse.col_ind.push_back(rowCols[i]);
+      if (rowCols[i] == iAgg) coarse.dia_ptr[iAgg] = begin + i;
+    }
+    coarse.row_ptr.push_back(coarse.col_ind.size());
+    coarse.matrix.resize(coarse.col_ind.size() * blkSz, ScalarType(0));
+
+    for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k) {
+      const auto iPoint = coarse.agg_idx[k];
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+        if (col_ind[index] >= nPoint) continue;
+        auto* block = &coarse.matrix[position[aggregate[col_ind[index]]] * blkSz];
+        for (auto i = 0ul; i < blkSz; ++i) block[i] += values[index * blkSz + i];
+      }
+    }
+
+    for (auto jAgg : rowCols) position[jAgg] = NONE;
+  }
+
+  /*--- Smoother and working memory. ---*/
+
+  coarse.invDiag.resize(nCoarse * blkSz);
+  ScalarType block[CSysMatrix<ScalarType>::MAXNVAR * CSysMatrix<ScalarType>::MAXNVAR];
+
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    fine.MatrixCopy(&coarse.matrix[coarse.dia_ptr[iAgg] * blkSz], block);
+    fine.MatrixInverse(block, &coarse.invDiag[iAgg * blkSz]);
+  }
+
+  coarse.sol.resize(nCoarse * nVar);
+  coarse.rhs.resize(nCoarse * nVar);
+  coarse.res.resize(nCoarse * nVar);
+
+  return true;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(const CSysMatrix<ScalarType>& fine) {
+  levels.clear();
+  fineRes.resize(fine.nPointDomain * fine.nVar);
+
+  /*--- The finest level is the domain part of the matrix, halo columns are ignored. ---*/
+
+  unsigned long nPoint = fine.nPointDomain;
+  const unsigned long* row_ptr = fine.row_ptr;
+  const unsigned long* col_ind = fine.col_ind;
+  const unsigned long* dia_ptr = fine.dia_ptr;
+  const ScalarType* values = fine.matrix;
+
+  while (levels.size() < MAX_LEVELS && nPoint > MIN_COARSE_POINTS) {
+    CLevel coarse;
+    if (!Coarsen(fine, nPoint, row_ptr, col_ind, dia_ptr, values, coarse)) break;
+    levels.push_back(std::move(coarse));
+
+    const auto& last = levels.back();
+    nPoint = last.nPoint;
+    row_ptr = last.row_ptr.data();
+    col_ind = last.col_ind.data();
+    dia_ptr = last.dia_ptr.data();
+    values = last.matrix.data();
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SmoothJacobi(const CSysMatrix<ScalarType>& fine, const CLevel& level,
+                                                   bool zeroGuess) const {
+  const auto nVar = fine.nVar;
+  const auto blkSz = nVar * nVar;
+  const ScalarType omega = AMG_RELAXATION;
+
+  if (!zeroGuess) {
+    SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+      auto* res = &level.res[iPoint * nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = level.rhs[iPoint * nVar + iVar];
+      for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint + 1]; ++k)
+        fine.MatrixVectorProductSub(&level.matrix[k * blkSz], &level.sol[level.col_ind[k] * nVar], res);
+    }
+    END_SU2_OMP_FOR
+  }
+  const auto& res = zeroGuess ? level.rhs : level.res;
+
+  SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+  for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+    ScalarType corr[CSysMatrix<ScalarType>::MAXNVAR];
+    fine.MatrixVectorProduct(&level.invDiag[iPoint * blkSz], &res[iPoint * nVar], corr);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      level.sol[iPoint * nVar + iVar] = (zeroGuess ? ScalarType(0) : level.sol[iPoint * nVar + iVar]) + omega * corr[iVar];
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SolveCoarsest(const CSysMatrix<ScalarType>& fine, const CLevel& level) const {
+  /*--- The coarsest level is small, the sequential sweeps are done by one thread. ---*/
+  SU2_OMP_MASTER {
+    const auto nVar = fine.nVar;
+    const auto blkSz = nVar * nVar;
+
+    auto relax = [&](unsigned long iPoint) {
+      ScalarType res[CSysMatrix<ScalarType>::MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = level.rhs[iPoint * nVar + iVar];
+      for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint + 1]; ++k) {
+        if (k == level.dia_ptr[iPoint]) continue;
+        fine.MatrixVectorProductSub(&level.matrix[k * blkSz], &level.sol[level.col_ind[k] * nVar], res);
+      }
+      fine.MatrixVectorProduct(&level.invDiag[iPoint * blkSz], res, &level.sol[iPoint * nVar]);
+    };
+
+    for (auto& x : level.sol) x = 0.0;
+
+    for (auto iSweep = 0ul; iSweep < COARSEST_SWEEPS; ++iSweep) {
+      for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) relax(iPoint);
+      for (auto iPoint = level.nPoint; iPoint > 0ul;) relax(--iPoint);
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(const CSysMatrix<ScalarType>& fine, unsigned long iLevel) const {
+  const auto& level = levels[iLevel];
+
+  if (iLevel + 1 == levels.size()) {
+    SolveCoarsest(fine, level);
+    return;
+  }
+  const auto& coarse = levels[iLevel + 1];
+  const auto nVar = fine.nVar;
+
+  /*--- Pre-smoothing and residual. ---*/
+
+  SmoothJacobi(fine, level, true);
+  SmoothJacobi(fine, level, false);
+
+  /*--- The smoother leaves the residual of the previous iterate in res, recompute it for the restriction. ---*/
+
+  SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+  for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+    auto* res = &level.res[iPoint * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = level.rhs[iPoint * nVar + iVar];
+    for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint + 1]; ++k)
+      fine.MatrixVectorProductSub(&level.matrix[k * nVar * nVar], &level.sol[level.col_ind[k] * nVar], res);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Restriction (sum over the points of each aggregate). ---*/
+
+  SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg * nVar + iVar] = 0.0;
+    for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        coarse.rhs[iAgg * nVar + iVar] += level.res[coarse.agg_idx[k] * nVar + iVar];
+  }
+  END_SU2_OMP_FOR
+
+  Cycle(fine, iLevel + 1);
+
+  /*--- Prolongation of the coarse correction. ---*/
+
+  SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+    for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        level.sol[coarse.agg_idx[k] * nVar + iVar] += coarse.sol[iAgg * nVar + iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing, same number of sweeps to keep the cycle symmetric. ---*/
+
+  SmoothJacobi(fine, level, false);
+  SmoothJacobi(fine, level, false);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const CSysMatrix<ScalarType>& fine, const CSysVector<ScalarType>& vec,
+                                            CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                            const CConfig* config) const {
+  const auto nVar = fine.nVar;
+  const auto blkSz = nVar * nVar;
+  const auto nPointDomain = fine.nPointDomain;
+  const ScalarType omega = AMG_RELAXATION;
+
+  /*--- Fine level damped Jacobi sweep, the result of the sweep is used to compute the residual (with halos). ---*/
+
+  auto smoothFine = [&](bool zeroGuess) {
+    if (!zeroGuess) {
+      SU2_OMP_FOR_DYN(fine.omp_heavy_size)
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        fine.RowProduct(prod, iPoint, &fineRes[iPoint * nVar]);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          fineRes[iPoint * nVar + iVar] = vec[iPoint * nVar + iVar] - fineRes[iPoint * nVar + iVar];
+      }
+      END_SU2_OMP_FOR
+    }
+    const ScalarType* res = zeroGuess ? &vec[0] : fineRes.data();
+
+    SU2_OMP_FOR_DYN(fine.omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      ScalarType corr[CSysMatrix<ScalarType>::MAXNVAR];
+      fine.MatrixVectorProduct(&fine.invM[iPoint * blkSz], &res[iPoint * nVar], corr);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        prod[iPoint * nVar + iVar] = (zeroGuess ? ScalarType(0) : prod[iPoint * nVar + iVar]) + omega * corr[iVar];
+    }
+    END_SU2_OMP_FOR
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+  };
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  smoothFine(true);
+
+  if (!levels.empty()) {
+    const auto& coarse = levels[0];
+
+    /*--- Residual and restriction. ---*/
+
+    SU2_OMP_FOR_DYN(fine.omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      fine.RowProduct(prod, iPoint, &fineRes[iPoint * nVar]);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        fineRes[iPoint * nVar + iVar] = vec[iPoint * nVar + iVar] - fineRes[iPoint * nVar + iVar];
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+    for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg * nVar + iVar] = 0.0;
+      for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          coarse.rhs[iAgg * nVar + iVar] += fineRes[coarse.agg_idx[k] * nVar + iVar];
+    }
+    END_SU2_OMP_FOR
+
+    Cycle(fine, 0);
+
+    /*--- Prolongation, the halos are updated by the post-smoothing. ---*/
+
+    SU2_OMP_FOR_STAT(CSysMatrix<ScalarType>::OMP_MIN_SIZE)
+    for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+      for (auto k = coarse.agg_ptr[iAgg]; k < coarse.agg_ptr[iAgg + 1]; ++k)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          prod[coarse.agg_idx[k] * nVar + iVar] += coarse.sol[iAgg * nVar + iVar];
+    }
+    END_SU2_OMP_FOR
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+  }
+
+  smoothFine(false);
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
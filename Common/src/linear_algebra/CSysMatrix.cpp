@@ -67,6 +67,9 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(sell_val);
+  MemoryAllocation::aligned_free(ILU_half);
+  MemoryAllocation::aligned_free(invM_half);
 
 #ifdef USE_MKL
   mkl_jit_destroy(MatrixMatrixProductJitter);
@@ -113,7 +116,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   }
 
   const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET) || (prec == AMG);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -164,6 +167,20 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
 
+  /*--- 16 bit copies of the factors that are applied in each linear iteration, not
+   *    used when the matrix is differentiated since the copies are passive. ---*/
+
+  if (std::is_arithmetic<ScalarType>::value && (ilu_needed || prec == JACOBI)) {
+    prec_storage = config->GetKind_Linear_Solver_Prec_Storage();
+  }
+  if (prec_storage != PREC_STORAGE::FULL) {
+    auto allocHalf = [](uint16_t*& ptr, unsigned long num) {
+      ptr = MemoryAllocation::aligned_alloc<uint16_t, true>(64, num * sizeof(uint16_t));
+    };
+    if (ilu_needed) allocHalf(ILU_half, nnz_ilu * nVar * nEqn);
+    allocHalf(invM_half, nPointDomain * nVar * nEqn);
+  }
+
   /*--- Thread parallel initialization. ---*/
 
   int num_threads = omp_get_max_threads();
@@ -173,6 +190,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   omp_light_size = computeStaticChunkSize(nnz * nVar * nEqn, num_threads, OMP_MAX_SIZE_L);
   omp_heavy_size = computeStaticChunkSize(nPointDomain, num_threads, OMP_MAX_SIZE_H);
 
+  /*--- Sliced copy for the products of small blocks, its chunk size
+   derives from the heavy one so it is built after the latter is set. ---*/
+
+  if (config->GetLinear_Solver_Sliced_ELL() && nVar == nEqn && nVar <= SELL_MAXNVAR) {
+    BuildSlicedPattern();
+    allocAndInit(sell_val, sell_ptr.back() * nVar * nEqn);
+  }
+
   omp_num_parts = config->GetLinear_Solver_Prec_Threads();
   if (omp_num_parts == 0) omp_num_parts = num_threads;
 
@@ -202,6 +227,16 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     }
   }
 
+  /*--- Levels of the triangular solves, as an alternative to the partitions. ---*/
+
+  if (config->GetLinear_Solver_Level_Scheduling() && (ilu_needed || prec == LU_SGS)) {
+    if (ilu_needed) {
+      BuildLevelSchedule(row_ptr_ilu, col_ind_ilu, dia_ptr_ilu);
+    } else {
+      BuildLevelSchedule(row_ptr, col_ind, dia_ptr);
+    }
+  }
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -562,6 +597,118 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   }
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSlicedPattern() {
+  const unsigned long C = SELL_C;
+  const auto nSlice = roundUpDiv(nPointDomain, C);
+  const auto rowSize = [&](unsigned long iPoint) { return row_ptr[iPoint + 1] - row_ptr[iPoint]; };
+
+  /*--- Sort the rows by size within windows of sigma rows, padding slots are marked with nPointDomain. ---*/
+
+  sell_row.resize(nSlice * C);
+  for (auto k = 0ul; k < sell_row.size(); ++k) sell_row[k] = min(k, nPointDomain);
+
+  const auto sigma = SELL_SIGMA * C;
+  for (auto begin = 0ul; begin < nPointDomain; begin += sigma) {
+    const auto end = min(begin + sigma, nPointDomain);
+    stable_sort(sell_row.begin() + begin, sell_row.begin() + end,
+                [&](unsigned long a, unsigned long b) { return rowSize(a) > rowSize(b); });
+  }
+
+  /*--- The width of a slice is the size of its largest row. ---*/
+
+  sell_ptr.assign(nSlice + 1, 0);
+  for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+    unsigned long width = 0;
+    for (auto l = 0ul; l < C; ++l) {
+      const auto iPoint = sell_row[iSlice * C + l];
+      if (iPoint < nPointDomain) width = max(width, rowSize(iPoint));
+    }
+    sell_ptr[iSlice + 1] = sell_ptr[iSlice] + width * C;
+  }
+
+  /*--- Columns and map to the CSR storage, padding points to the row itself (or to 0) with zero values. ---*/
+
+  sell_col.resize(sell_ptr.back());
+  sell_map.resize(sell_ptr.back());
+
+  for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+    const auto width = (sell_ptr[iSlice + 1] - sell_ptr[iSlice]) / C;
+    for (auto l = 0ul; l < C; ++l) {
+      const auto iPoint = sell_row[iSlice * C + l];
+      const auto size = (iPoint < nPointDomain) ? rowSize(iPoint) : 0ul;
+      for (auto j = 0ul; j < width; ++j) {
+        const auto slot = sell_ptr[iSlice] + j * C + l;
+        if (j < size) {
+          sell_col[slot] = col_ind[row_ptr[iPoint] + j];
+          sell_map[slot] = row_ptr[iPoint] + j;
+        } else {
+          sell_col[slot] = (iPoint < nPointDomain) ? iPoint : 0;
+          sell_map[slot] = nnz;
+        }
+      }
+    }
+  }
+
+  omp_sell_size = max<unsigned long>(1, omp_heavy_size / C);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::UpdateSlicedValues() {
+  if (sell_val == nullptr) return;
+
+  /*--- Block entries are stored entry by entry for each group of C slots. ---*/
+  const unsigned long C = SELL_C;
+  const auto blkSz = nVar * nEqn;
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto slot = 0ul; slot < sell_map.size(); ++slot) {
+    const auto l = slot % C;
+    const auto index = sell_map[slot];
+    for (auto e = 0ul; e < blkSz; ++e)
+      sell_val[(slot - l) * blkSz + e * C + l] = (index < nnz) ? matrix[index * blkSz + e] : ScalarType(0);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  sell_valid = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+template <unsigned long nVar_>
+void CSysMatrix<ScalarType>::SlicedProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  constexpr unsigned long C = SELL_C;
+  constexpr auto blkSz = nVar_ * nVar_;
+  const auto nSlice = sell_ptr.size() - 1;
+
+  SU2_OMP_FOR_DYN(omp_sell_size)
+  for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+    ScalarType acc[nVar_][C];
+    for (auto i = 0ul; i < nVar_; ++i)
+      for (auto l = 0ul; l < C; ++l) acc[i][l] = 0.0;
+
+    for (auto slot = sell_ptr[iSlice]; slot < sell_ptr[iSlice + 1]; slot += C) {
+      const ScalarType* val = &sell_val[slot * blkSz];
+      const unsigned long* col = &sell_col[slot];
+
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto l = 0ul; l < C; ++l) {
+        for (auto i = 0ul; i < nVar_; ++i)
+          for (auto j = 0ul; j < nVar_; ++j) acc[i][l] += val[(i * nVar_ + j) * C + l] * vec[col[l] * nVar_ + j];
+      }
+    }
+
+    for (auto l = 0ul; l < C; ++l) {
+      const auto iPoint = sell_row[iSlice * C + l];
+      if (iPoint < nPointDomain)
+        for (auto i = 0ul; i < nVar_; ++i) prod[iPoint * nVar_ + i] = acc[i][l];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
@@ -581,11 +728,19 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  if (sell_valid) {
+    if (nVar == 1) {
+      SlicedProduct<1>(vec, prod);
+    } else {
+      SlicedProduct<2>(vec, prod);
+    }
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -593,6 +748,60 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildLevelSchedule(const unsigned long* row_ptr_prec, const unsigned long* col_ind_prec,
+                                                const unsigned long* dia_ptr_prec) {
+  if (nPointDomain == 0) return;
+
+  vector<unsigned long> level(nPointDomain);
+
+  /*--- Counting sort of the rows by level. ---*/
+  auto sortByLevel = [&](CLevelSchedule& schedule) {
+    const auto nLevel = *max_element(level.begin(), level.end()) + 1;
+    schedule.ptr.assign(nLevel + 1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) ++schedule.ptr[level[iPoint] + 1];
+    for (auto iLevel = 0ul; iLevel < nLevel; ++iLevel) schedule.ptr[iLevel + 1] += schedule.ptr[iLevel];
+
+    auto pos = schedule.ptr;
+    schedule.rows.resize(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) schedule.rows[pos[level[iPoint]]++] = iPoint;
+  };
+
+  /*--- Forward substitution, a row depends on the rows of its lower triangular part. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    level[iPoint] = 0;
+    for (auto index = row_ptr_prec[iPoint]; index < dia_ptr_prec[iPoint]; ++index)
+      level[iPoint] = max(level[iPoint], level[col_ind_prec[index]] + 1);
+  }
+  sortByLevel(lower_levels);
+
+  /*--- Backward substitution, a row depends on the rows of its upper triangular part, excluding halos. ---*/
+
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    --iPoint;
+    level[iPoint] = 0;
+    for (auto index = dia_ptr_prec[iPoint] + 1; index < row_ptr_prec[iPoint + 1]; ++index) {
+      const auto jPoint = col_ind_prec[index];
+      if (jPoint < nPointDomain) level[iPoint] = max(level[iPoint], level[jPoint] + 1);
+    }
+  }
+  sortByLevel(upper_levels);
+}
+
+template <class ScalarType>
+template <class RowFunction>
+void CSysMatrix<ScalarType>::LevelScheduledLoop(const CLevelSchedule& levels, const RowFunction& rowFun) const {
+  for (auto iLevel = 0ul; iLevel + 1 < levels.ptr.size(); ++iLevel) {
+    const auto begin = levels.ptr[iLevel];
+    const auto end = levels.ptr[iLevel + 1];
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(end - begin, omp_get_num_threads(), OMP_MAX_SIZE_H))
+    for (auto k = begin; k < end; ++k) rowFun(levels.rows[k]);
+    END_SU2_OMP_FOR
+  }
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
@@ -600,6 +809,67 @@ void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
     InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
   END_SU2_OMP_FOR
+
+  if (prec_storage != PREC_STORAGE::FULL) CompressFactors(invM, nPointDomain * nVar * nVar, invM_half);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::CompressFactors(const ScalarType* src, unsigned long size, uint16_t* dst) const {
+  using namespace HalfPrecision;
+  const bool bf16 = (prec_storage == PREC_STORAGE::BF16);
+  unsigned long nClamped = 0;
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto i = 0ul; i < size; ++i) {
+    const auto val = static_cast<float>(SU2_TYPE::GetValue(src[i]));
+    if (bf16) {
+      dst[i] = BFloat16::Encode(val);
+    } else {
+      /*--- Infinity in the factors would turn the preconditioned vectors into NaN. ---*/
+      nClamped += (val > Float16::Max() || val < -Float16::Max());
+      dst[i] = Float16::EncodeSaturated(val);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Sum the count over threads and ranks, the master rank warns once (the flag is the same on all ranks). ---*/
+
+  if (bf16 || half_clamp_warned) return;
+  if (nClamped > 0) atomicAdd(nClamped, half_clamped);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    unsigned long nClampedGlobal = 0;
+    SU2_MPI::Allreduce(&half_clamped, &nClampedGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    half_clamped = 0;
+    half_clamp_warned = (nClampedGlobal > 0);
+    if (half_clamp_warned && rank == MASTER_NODE) {
+      cout << "WARNING: " << nClampedGlobal << " preconditioner factors exceed the FP16 range and were clamped to "
+           << Float16::Max() << ", consider LINEAR_SOLVER_PREC_STORAGE= BF16." << endl;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+template <class Blocks>
+void CSysMatrix<ScalarType>::JacobiProduct(const Blocks& invD, const CSysVector<ScalarType>& vec,
+                                           CSysVector<ScalarType>& prod) const {
+  if (nVar == 1) {
+    /*--- Scalar systems, element-wise product that the compiler can vectorize. ---*/
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      ScalarType buf;
+      prod[iPoint] = *invD(iPoint, &buf) * vec[iPoint];
+    }
+    END_SU2_OMP_FOR
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      ScalarType buf[MAXNVAR * MAXNVAR];
+      MatrixVectorProduct(invD(iPoint, buf), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
 }
 
 template <class ScalarType>
@@ -608,16 +878,42 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
                                                          const CConfig* config) const {
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
-  END_SU2_OMP_FOR
+  const auto blkSz = nVar * nVar;
+  switch (prec_storage) {
+    case PREC_STORAGE::FULL:
+      JacobiProduct(CFullBlocks{invM, blkSz}, vec, prod);
+      break;
+    case PREC_STORAGE::BF16:
+      JacobiProduct(CHalfBlocks<HalfPrecision::BFloat16>{invM_half, blkSz}, vec, prod);
+      break;
+    case PREC_STORAGE::FP16:
+      JacobiProduct(CHalfBlocks<HalfPrecision::Float16>{invM_half, blkSz}, vec, prod);
+      break;
+  }
 
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+  /*--- The fine level smoother is block-Jacobi. ---*/
+  BuildJacobiPreconditioner();
+
+  /*--- The coarse levels are built sequentially, their setup is cheap compared to the fine level. ---*/
+  SU2_OMP_MASTER
+  amg.Build(*this);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  amg.Apply(*this, vec, prod, geometry, config);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   /*--- Copy block matrix to compute factorization in-place. ---*/
@@ -647,123 +943,174 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
-  /*--- OpenMP Parallelization, a loop construct is used to ensure
-   *    the preconditioner is computed correctly even if called
-   *    outside of a parallel section. ---*/
+  /*--- Eliminate the lower part of a row using the rows in [begin, end[, which must have been processed,
+   *    and then invert and store the diagonal block to later compute the weights of the next rows. ---*/
 
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  auto factorizeRow = [&](unsigned long iPoint, unsigned long begin, unsigned long end) {
+    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
 
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
-     *    what the MPI-only implementation does. ---*/
+    /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+      auto jPoint = col_ind_ilu[index];
 
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
+      /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+      if (jPoint < begin) continue;
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+      /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        auto jPoint = col_ind_ilu[index];
+      auto Block_ij = &ILU_matrix[index * nVar * nVar];
+      MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+      /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-        if (jPoint < begin) continue;
+      for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+        /*--- Get the column index (kPoint > jPoint). ---*/
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+        auto kPoint = col_ind_ilu[index_];
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+        if (kPoint >= end) break;
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+        /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+        auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
 
-          auto kPoint = col_ind_ilu[index_];
+        if (Block_ik != nullptr) {
+          auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+          MatrixMatrixProduct(weight, Block_jk, aux_block);
+          MatrixSubtraction(Block_ik, aux_block, Block_ik);
+        }
+      }
 
-          if (kPoint >= end) break;
+      /*--- Lastly, store "weight" in the lower triangular part, which
+       will be reused during the forward solve in the precon/smoother. ---*/
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+      for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+    }
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+    InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+  };
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+  if (!lower_levels.ptr.empty()) {
+    /*--- The rows of a level only depend on rows of previous levels, the result is the same as the
+     *    sequential factorization of the entire matrix. ---*/
+
+    LevelScheduledLoop(lower_levels, [&](unsigned long iPoint) { factorizeRow(iPoint, 0, nPointDomain); });
+  } else {
+    /*--- OpenMP Parallelization, a loop construct is used to ensure
+     *    the preconditioner is computed correctly even if called
+     *    outside of a parallel section. ---*/
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
-      }
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
+       *    what the MPI-only implementation does. ---*/
+
+      for (auto iPoint = begin; iPoint < end; iPoint++) factorizeRow(iPoint, begin, end);
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+    END_SU2_OMP_FOR
+  }
+
+  if (prec_storage != PREC_STORAGE::FULL) {
+    CompressFactors(ILU_matrix, nnz_ilu * nVar * nVar, ILU_half);
+    CompressFactors(invM, nPointDomain * nVar * nVar, invM_half);
   }
-  END_SU2_OMP_FOR
 }
 
 template <class ScalarType>
-void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
-                                                      CGeometry* geometry, const CConfig* config) const {
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
+template <class Blocks>
+void CSysMatrix<ScalarType>::ILUSubstitutions(const Blocks& LU, const Blocks& invD, const CSysVector<ScalarType>& vec,
+                                              CSysVector<ScalarType>& prod) const {
+  /*--- Forward solve the system using the lower matrix entries that
+   were computed and stored during the ILU preprocessing. Note
+   that we are overwriting the residual vector as we go. ---*/
+
+  auto forwardRow = [&](unsigned long iPoint, unsigned long begin) {
+    ScalarType block[MAXNVAR * MAXNVAR];
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint < begin) continue;
+      MatrixVectorProductSub(LU(index, block), &prod[jPoint * nVar], &prod[iPoint * nVar]);
+    }
+  };
+
+  /*--- Backwards substitution. ---*/
+
+  auto backwardRow = [&](unsigned long iPoint, unsigned long end) {
+    ScalarType aux_vec[MAXNVAR], block[MAXNVAR * MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint >= end) break;
+      MatrixVectorProductSub(LU(index, block), &prod[jPoint * nVar], aux_vec);
+    }
+
+    MatrixVectorProduct(invD(iPoint, block), aux_vec, &prod[iPoint * nVar]);
+  };
+
+  if (!lower_levels.ptr.empty()) {
+    /*--- Level scheduling, same result as the sequential substitutions. ---*/
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = vec[iPoint * nVar + iVar];
+    END_SU2_OMP_FOR
+
+    LevelScheduledLoop(lower_levels, [&](unsigned long iPoint) { forwardRow(iPoint, 0); });
+    LevelScheduledLoop(upper_levels, [&](unsigned long iPoint) { backwardRow(iPoint, nPointDomain); });
+    return;
+  }
 
-  /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
-
-    ScalarType aux_vec[MAXNVAR];
 
     /*--- Copy vector to then work on prod in place ---*/
 
     for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    for (auto iPoint = begin + 1; iPoint < end; iPoint++) forwardRow(iPoint, begin);
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
-    }
-
-    /*--- Backwards substitution (starts at the last row) ---*/
+    /*--- Starts at the last row. ---*/
 
     for (auto iPoint = end; iPoint > begin;) {
       iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
-
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
-
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      backwardRow(iPoint, end);
     }
   }
   END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- OpenMP Parallelization, the factors are decoded on the fly if stored in 16 bits. ---*/
+  const auto blkSz = nVar * nVar;
+  switch (prec_storage) {
+    case PREC_STORAGE::FULL:
+      ILUSubstitutions(CFullBlocks{ILU_matrix, blkSz}, CFullBlocks{invM, blkSz}, vec, prod);
+      break;
+    case PREC_STORAGE::BF16:
+      using BF16Blocks = CHalfBlocks<HalfPrecision::BFloat16>;
+      ILUSubstitutions(BF16Blocks{ILU_half, blkSz}, BF16Blocks{invM_half, blkSz}, vec, prod);
+      break;
+    case PREC_STORAGE::FP16:
+      using FP16Blocks = CHalfBlocks<HalfPrecision::Float16>;
+      ILUSubstitutions(FP16Blocks{ILU_half, blkSz}, FP16Blocks{invM_half, blkSz}, vec, prod);
+      break;
+  }
 
   /*--- MPI Parallelization ---*/
 
@@ -777,58 +1124,69 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
                                                          const CConfig* config) const {
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
+  auto forwardRow = [&](unsigned long iPoint, unsigned long begin) {
+    ScalarType low_prod[MAXNVAR];
+    auto idx = iPoint * nVar;
+    LowerProduct(prod, iPoint, begin, low_prod);         // Compute L.x*
+    VectorSubtraction(&vec[idx], low_prod, &prod[idx]);  // Compute y = b - L.x*
+    Gauss_Elimination(iPoint, &prod[idx]);               // Solve D.x* = y
+  };
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
 
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1", except the last thread that also considers halos.
-     *    This is NOT exactly equivalent to the MPI implementation on the same
-     *    number of domains, for that we would need to define "thread-halos". ---*/
+  auto backwardRow = [&](unsigned long iPoint, unsigned long row_end) {
+    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+    auto idx = iPoint * nVar;
+    DiagonalProduct(prod, iPoint, dia_prod);           // Compute D.x*
+    UpperProduct(prod, iPoint, row_end, up_prod);      // Compute U.x_(n+1)
+    VectorSubtraction(dia_prod, up_prod, &prod[idx]);  // Compute y = D.x*-U.x_(n+1)
+    Gauss_Elimination(iPoint, &prod[idx]);             // Solve D.x* = y
+  };
 
-    ScalarType low_prod[MAXNVAR];
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
 
-    for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint * nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);         // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]);  // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);               // Solve D.x* = y
+  if (!lower_levels.ptr.empty()) {
+    /*--- Level scheduling, same result as the sequential sweeps. ---*/
+    LevelScheduledLoop(lower_levels, [&](unsigned long iPoint) { forwardRow(iPoint, 0); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1", except the last thread that also considers halos.
+       *    This is NOT exactly equivalent to the MPI implementation on the same
+       *    number of domains, for that we would need to define "thread-halos". ---*/
+
+      for (auto iPoint = begin; iPoint < end; ++iPoint) forwardRow(iPoint, begin);
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
 
-  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
-
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto row_end = omp_partitions[thread + 1];
-    if (begin == row_end) continue;
-
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
-
-    for (auto iPoint = row_end; iPoint > begin;) {
-      iPoint--;  // because of unsigned type
-      auto idx = iPoint * nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);           // Compute D.x*
-      UpperProduct(prod, iPoint, row_end, up_prod);      // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]);  // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);             // Solve D.x* = y
+  if (!lower_levels.ptr.empty()) {
+    LevelScheduledLoop(upper_levels, [&](unsigned long iPoint) { backwardRow(iPoint, nPointDomain); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto row_end = omp_partitions[thread + 1];
+
+      for (auto iPoint = row_end; iPoint > begin;) {
+        iPoint--;  // because of unsigned type
+        backwardRow(iPoint, row_end);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
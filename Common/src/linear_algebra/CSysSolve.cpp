@@ -172,6 +172,67 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::StartDots(const vector<pair<const VectorType*, const VectorType*> >& pairs) const {
+  const auto n = pairs.size();
+  const auto nElmDomain = pairs[0].first->GetNElmDomain();
+
+  /*--- All threads get the same "view" of the vectors and shared variables. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    dotsLocal.assign(n, ScalarType(0));
+    dotsGlobal.resize(n);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Local dot products for each thread. ---*/
+  vector<ScalarType> sum(n, ScalarType(0));
+
+  SU2_OMP_FOR_(schedule(static, computeStaticChunkSize(nElmDomain, omp_get_num_threads(), 4096)) SU2_NOWAIT)
+  for (auto i = 0ul; i < nElmDomain; ++i) {
+    for (auto k = 0ul; k < n; ++k) sum[k] += (*pairs[k].first)[i] * (*pairs[k].second)[i];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Update shared variables with "our" partial sums. ---*/
+  for (auto k = 0ul; k < n; ++k) atomicAdd(sum[k], dotsLocal[k]);
+
+  /*--- Start the reduction across all mpi ranks, only master thread communicates. ---*/
+  SU2_OMP_BARRIER
+#ifdef HAVE_MPI
+  SU2_OMP_MASTER {
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Iallreduce(dotsLocal.data(), dotsGlobal.data(), n, mpi_type, MPI_SUM,
+                                                SU2_MPI::GetComm(), &dotsRequest);
+  }
+  END_SU2_OMP_MASTER
+#endif
+}
+
+template <class ScalarType>
+void CSysSolve<ScalarType>::CompleteDots(ScalarType* dots) const {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+#ifdef HAVE_MPI
+    SelectMPIWrapper<ScalarType>::W::Wait(&dotsRequest, MPI_STATUS_IGNORE);
+#else
+    dotsGlobal = dotsLocal;
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  for (auto k = 0ul; k < dotsGlobal.size(); ++k) dots[k] = dotsGlobal[k];
+}
+
+template <class ScalarType>
+void CSysSolve<ScalarType>::AllocatePipelineVectors(unsigned long n, const VectorType& x) const {
+  if (P.size() >= n) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    P.resize(n);
+    for (auto& vec : P) vec.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -737,6 +798,439 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long m, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool identity = precond.IsIdentity();
+
+  /*--- Classical Gram-Schmidt loses orthogonality when the new vector is close to the span of the
+   * basis, in that case a second pass is done ("twice is enough", Kahan-Parlett criterion). ---*/
+  const ScalarType reorth = 0.5;
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, W is the orthonormal basis and Z = A * M^-1 * W. ---*/
+
+  if (W.size() <= m || Z.size() <= m) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      Z.resize(m + 1);
+      for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  AllocatePipelineVectors(1, x);
+  auto& tmp = P[0];
+
+  /*--- Preconditioned operator. ---*/
+
+  auto op = [&](const VectorType& u, VectorType& v) {
+    if (identity) {
+      mat_vec(u, v);
+    } else {
+      precond(u, tmp);
+      mat_vec(tmp, v);
+    }
+  };
+
+  /*--- Define various arrays (private to each thread, see FGMRES_LinSolver). ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m);
+  H = ScalarType(0);
+  vector<ScalarType> dots(m + 2);
+  vector<pair<const VectorType*, const VectorType*> > pairs;
+  pairs.reserve(m + 2);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= -beta;
+  g[0] = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PFGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Fill the pipeline. ---*/
+
+  op(W[0], Z[0]);
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol * norm0) break;
+
+    /*--- Start the reduction of the dot products of Z[i] with the basis and with itself... ---*/
+
+    pairs.clear();
+    for (unsigned long k = 0; k <= i; k++) pairs.emplace_back(&Z[i], &W[k]);
+    pairs.emplace_back(&Z[i], &Z[i]);
+    StartDots(pairs);
+
+    /*--- ...and overlap it with the product of the next vector, before it is orthogonalized. ---*/
+
+    if (i + 1 < m) op(Z[i], Z[i + 1]);
+
+    CompleteDots(dots.data());
+
+    /*--- Classical Gram-Schmidt, the norm of the new vector is obtained from the Pythagorean theorem. ---*/
+
+    ScalarType nrm = dots[i + 1];
+    W[i + 1] = Z[i];
+    for (unsigned long k = 0; k <= i; k++) {
+      H[k][i] = dots[k];
+      nrm -= pow(dots[k], 2);
+      W[i + 1] -= dots[k] * W[k];
+    }
+
+    if (!(nrm > reorth * dots[i + 1])) {
+      /*--- Second pass, also with a single (but blocking) reduction. ---*/
+      pairs.clear();
+      for (unsigned long k = 0; k <= i; k++) pairs.emplace_back(&W[i + 1], &W[k]);
+      pairs.emplace_back(&W[i + 1], &W[i + 1]);
+      StartDots(pairs);
+      CompleteDots(dots.data());
+
+      nrm = dots[i + 1];
+      for (unsigned long k = 0; k <= i; k++) {
+        H[k][i] += dots[k];
+        nrm -= pow(dots[k], 2);
+        W[i + 1] -= dots[k] * W[k];
+      }
+
+      /*--- nrm is the result of a reduction, all ranks take the same decision. ---*/
+      if ((nrm <= 0.0) || (nrm != nrm)) {
+        SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+    }
+    nrm = sqrt(nrm);
+    H[i + 1][i] = nrm;
+    W[i + 1] /= nrm;
+
+    /*--- Correct the product computed in the pipeline, Z[i+1] = A * M^-1 * W[i+1]. ---*/
+
+    if (i + 1 < m) {
+      for (unsigned long k = 0; k <= i; k++) Z[i + 1] -= H[k][i] * Z[k];
+      Z[i + 1] /= nrm;
+    }
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i + 1]);
+
+    /*---  Output the relative residual if necessary ---*/
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution, x += M^-1 * W * y.
+   * Z is no longer needed and the preconditioner is linear, it is applied once to the combination. ---*/
+
+  SolveReduced(i, H, g, y);
+
+  auto& update = Z[0];
+  update = ScalarType(0);
+  for (unsigned long k = 0; k < i; k++) update += y[k] * W[k];
+
+  if (identity) {
+    x += update;
+  } else {
+    precond(update, tmp);
+    x += tmp;
+  }
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PFGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PBCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                        const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                        unsigned long m, ScalarType& residual, bool monitoring,
+                                                        const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool identity = precond.IsIdentity();
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. The method works with the right-preconditioned operator A * M^-1,
+   * the updates of the solution are accumulated in u and the preconditioner is applied to it at the end. ---*/
+
+  AllocatePipelineVectors(10, x);
+  auto& r = P[0];
+  auto& r_0 = P[1];
+  auto& w = P[2];
+  auto& t = P[3];
+  auto& p = P[4];
+  auto& s = P[5];
+  auto& z = P[6];
+  auto& v = P[7];
+  auto& u = P[8];
+  auto& tmp = P[9];
+
+  auto op = [&](const VectorType& in, VectorType& out) {
+    if (identity) {
+      mat_vec(in, out);
+    } else {
+      precond(in, tmp);
+      mat_vec(tmp, out);
+    }
+  };
+
+  ScalarType dots[5];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, tmp);
+    r = b - tmp;
+  } else {
+    r = b;
+  }
+
+  norm_r = r.norm();
+  norm0 = b.norm();
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+  if ((norm_r < tol * norm0) || (norm_r < eps)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PBCGSTAB(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = norm_r / norm0;
+    return 0;
+  }
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PBCGSTAB", tol, norm_r);
+      WriteHistory(i, norm_r / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Initialization, w = A r and t = A w, the second product overlaps the first reduction. ---*/
+
+  r_0 = r;
+  op(r, w);
+  StartDots({{&r_0, &r}, {&r_0, &w}});
+  op(w, t);
+  CompleteDots(dots);
+
+  /*--- Breakdown, a quotient would exceed 1/eps, or r_0 became (nearly) orthogonal to r. ---*/
+
+  const ScalarType norm_r0 = norm_r;
+  auto breakdown = [&](ScalarType num, ScalarType den) { return fabs(den) <= eps * fabs(num); };
+  auto orthogonal = [&](ScalarType dot) { return fabs(dot) <= eps * norm_r0 * norm_r; };
+
+  ScalarType rho = dots[0], alpha = 0.0, beta = 0.0, omega = 0.0;
+  p = ScalarType(0.0);
+  s = ScalarType(0.0);
+  z = ScalarType(0.0);
+  v = ScalarType(0.0);
+  u = ScalarType(0.0);
+
+  const bool stop = orthogonal(rho) || breakdown(rho, dots[1]);
+  if (!stop) alpha = rho / dots[1];
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m && !stop; i++) {
+    /*--- Update the directions, s = A p, z = A s (by recurrence). ---*/
+
+    p = beta * (p - omega * s) + r;
+    s = beta * (s - omega * z) + w;
+    z = beta * (z - omega * v) + t;
+
+    /*--- Intermediate residual "q" (stored in r) and its product "y" (stored in w). ---*/
+
+    r -= alpha * s;
+    w -= alpha * z;
+
+    /*--- Step-length omega, the reduction overlaps v = A z. ---*/
+
+    StartDots({{&r, &w}, {&w, &w}});
+    op(z, v);
+    CompleteDots(dots);
+
+    /*--- Avoid division by 0. ---*/
+
+    if (breakdown(dots[0], dots[1])) {
+      u += alpha * p;
+      break;
+    }
+    omega = dots[0] / dots[1];
+
+    /*--- Update solution and residual, w = A r (by recurrence). ---*/
+
+    u += alpha * p + omega * r;
+    r -= omega * w;
+    w -= omega * (t - alpha * v);
+
+    /*--- Scalars for the next iteration and residual norm, the reduction overlaps t = A w. ---*/
+
+    StartDots({{&r_0, &r}, {&r_0, &w}, {&r_0, &s}, {&r_0, &z}, {&r, &r}});
+    op(w, t);
+    CompleteDots(dots);
+
+    norm_r = sqrt(dots[4]);
+
+    /*--- Check if solution has converged or the iteration broke down, else output the relative residual ---*/
+
+    if (norm_r < tol * norm0 || orthogonal(dots[0]) || breakdown(alpha, omega)) break;
+
+    beta = (alpha / omega) * (dots[0] / rho);
+    rho = dots[0];
+    const ScalarType den = dots[1] + beta * (dots[2] - omega * dots[3]);
+
+    if (breakdown(rho, den)) break;
+    alpha = rho / den;
+
+    if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*--- Apply the preconditioner to the accumulated update. ---*/
+
+  if (identity) {
+    x += u;
+  } else {
+    precond(u, tmp);
+    x += tmp;
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PBCGSTAB", i, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, tmp);
+      r = b - tmp;
+      ScalarType true_res = r.norm();
+
+      if ((fabs(true_res - norm_r) > tol * 10.0) && (masterRank)) {
+        SU2_OMP_MASTER
+        WriteWarning(norm_r, true_res, tol);
+        END_SU2_OMP_MASTER
+      }
+    }
+  }
+
+  residual = norm_r / norm0;
+  return i;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                         const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -952,9 +1446,10 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-    /*--- Build preconditioner. ---*/
+    /*--- Build preconditioner, and update the format used in the products if needed. ---*/
 
     precond->Build();
+    Jacobian.UpdateSlicedValues();
 
     /*--- Solve system. ---*/
 
@@ -973,6 +1468,14 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case PIPELINED_FGMRES:
+        IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                       ScreenOutput, config);
+        break;
+      case PIPELINED_BCGSTAB:
+        IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                        residual, ScreenOutput, config);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
@@ -992,6 +1495,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
     }
 
+    Jacobian.InvalidateSlicedValues();
+
     SU2_OMP_MASTER {
       Residual = residual;
       Iterations = IterLinSol;
@@ -1022,6 +1527,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case ILU:
           if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner();
+          break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
@@ -1109,6 +1617,7 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
     Jacobian.TransposeInPlace();
     precond->Build();
   }
+  Jacobian.UpdateSlicedValues();
 
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
@@ -1132,6 +1641,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                     ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config);
+      break;
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                 ScreenOutput, config);
@@ -1152,6 +1669,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       break;
   }
 
+  Jacobian.InvalidateSlicedValues();
+
   HandleTemporariesOut(LinSysSol);
 
   delete precond;
@@ -0,0 +1,82 @@
+/*!
+ * \file CBinomialCheckpointing.cpp
+ * \brief Implementation of the binomial checkpointing schedule.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CBinomialCheckpointing.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <limits>
+
+unsigned long CBinomialCheckpointing::Beta(unsigned long s, unsigned long r) {
+  /*--- Multiplicative formula, each partial product is itself a binomial coefficient. ---*/
+  const auto maxValue = std::numeric_limits<unsigned long>::max();
+  unsigned long beta = 1;
+  for (unsigned long i = 1; i <= s; ++i) {
+    if (beta > maxValue / (r + i)) return maxValue;
+    beta = beta * (r + i) / i;
+  }
+  return beta;
+}
+
+long CBinomialCheckpointing::Restore(long step) {
+  if (step < 0) SU2_MPI::Error("The initial condition cannot be requested.", CURRENT_FUNCTION);
+
+  while (!checkpoints.empty() && checkpoints.back() > step) checkpoints.pop_back();
+
+  const long start = checkpoints.empty() ? -1 : checkpoints.back();
+  nextTarget = -1;
+  nAdvances += step - start;
+  return start;
+}
+
+bool CBinomialCheckpointing::Store(long step, long target) {
+  if (target != nextTarget) {
+    nextTarget = target;
+    nextStep = NextCheckpoint(target);
+  }
+  if (step != nextStep) return false;
+
+  checkpoints.push_back(step);
+  nextStep = NextCheckpoint(target);
+  return true;
+}
+
+long CBinomialCheckpointing::NextCheckpoint(long target) const {
+  const unsigned long nFree = nCheckpoints - checkpoints.size();
+  const long last = checkpoints.empty() ? -1 : checkpoints.back();
+  const unsigned long nSteps = target - last;
+  if (nFree == 0 || nSteps < 2) return -1;
+
+  /*--- With s free checkpoints, l steps from the last one to the target need r recomputations, where
+   * r is the smallest number with beta(s,r) >= l. The next checkpoint is placed beta(s,r-1) steps after
+   * the last one. Since beta(s,r) = beta(s,r-1) + beta(s-1,r), the segment before it can be reversed with
+   * s checkpoints and r-1 recomputations, and the segment after it with s-1 checkpoints and r. ---*/
+
+  unsigned long r = 0;
+  while (Beta(nFree, r) < nSteps) ++r;
+
+  return last + static_cast<long>(Beta(nFree, r - 1));
+}
@@ -0,0 +1,189 @@
+/*!
+ * \file CCacheFile.cpp
+ * \brief Binary cache files for the graph partitioning and the wall distance.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CCacheFile.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+/*--- Layout: magic, number of ranks, global key, (local key, block size) per rank, blocks in rank order. ---*/
+
+constexpr char magic[] = "SU2GCv01";
+constexpr size_t magicSize = 8;
+constexpr size_t fixedHeaderSize = magicSize + 2 * sizeof(uint64_t);
+
+size_t HeaderSize(int nRanks) { return fixedHeaderSize + 2 * nRanks * sizeof(uint64_t); }
+
+#ifdef HAVE_MPI
+/*--- MPI counts are int, large blocks are transferred in chunks. All ranks need to take part
+ in the same number of collective calls, even if they have nothing (left) to transfer. ---*/
+
+bool TransferAll(MPI_File fileHandle, uint64_t offset, char* bytes, uint64_t nBytes, bool write) {
+  constexpr uint64_t maxChunkSize = 1ull << 30;
+  const unsigned long nChunks = (nBytes + maxChunkSize - 1) / maxChunkSize;
+  unsigned long maxChunks = 0;
+  SU2_MPI::Allreduce(&nChunks, &maxChunks, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  bool ok = true;
+  for (unsigned long iChunk = 0; iChunk < maxChunks; ++iChunk) {
+    const auto begin = std::min(iChunk * maxChunkSize, nBytes);
+    const auto count = std::min(maxChunkSize, nBytes - begin);
+
+    MPI_Status status;
+    if (write) {
+      MPI_File_write_at_all(fileHandle, offset + begin, bytes + begin, static_cast<int>(count), MPI_BYTE, &status);
+    } else {
+      MPI_File_read_at_all(fileHandle, offset + begin, bytes + begin, static_cast<int>(count), MPI_BYTE, &status);
+    }
+    int nDone = 0;
+    MPI_Get_count(&status, MPI_BYTE, &nDone);
+    ok &= (static_cast<uint64_t>(nDone) == count);
+  }
+  return ok;
+}
+#endif
+
+}  // namespace
+
+void CCacheFile::Write(const std::string& fileName, uint64_t key, uint64_t localKey,
+                           const std::vector<char>& localData) {
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Every rank needs the block sizes of the previous ranks for its offset. ---*/
+
+  unsigned long local[] = {static_cast<unsigned long>(localKey), static_cast<unsigned long>(localData.size())};
+  std::vector<unsigned long> table(2 * size);
+  SU2_MPI::Allgather(local, 2, MPI_UNSIGNED_LONG, table.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  uint64_t offset = HeaderSize(size);
+  for (int iRank = 0; iRank < rank; ++iRank) offset += table[2 * iRank + 1];
+
+  std::vector<char> header(HeaderSize(size));
+  memcpy(header.data(), magic, magicSize);
+  uint64_t* values = reinterpret_cast<uint64_t*>(header.data() + magicSize);
+  values[0] = size;
+  values[1] = key;
+  for (int i = 0; i < 2 * size; ++i) values[2 + i] = table[i];
+
+  bool ok = true;
+#ifdef HAVE_MPI
+  MPI_File fileHandle;
+  ok = MPI_File_open(SU2_MPI::GetComm(), fileName.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
+                     &fileHandle) == MPI_SUCCESS;
+  if (ok) {
+    MPI_File_set_size(fileHandle, 0);
+    if (rank == MASTER_NODE) {
+      MPI_File_write_at(fileHandle, 0, header.data(), header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+    ok = TransferAll(fileHandle, offset, const_cast<char*>(localData.data()), localData.size(), true);
+    MPI_File_close(&fileHandle);
+  }
+#else
+  FILE* fileHandle = fopen(fileName.c_str(), "wb");
+  ok = (fileHandle != nullptr);
+  if (ok) {
+    ok = fwrite(header.data(), 1, header.size(), fileHandle) == header.size();
+    ok &= fwrite(localData.data(), 1, localData.size(), fileHandle) == localData.size();
+    fclose(fileHandle);
+  }
+#endif
+
+  if (!ok && rank == MASTER_NODE) {
+    std::cout << "WARNING: Could not write the cache file " << fileName << "." << std::endl;
+  }
+}
+
+bool CCacheFile::Read(const std::string& fileName, uint64_t key, uint64_t localKey,
+                          std::vector<char>& localData) {
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  std::vector<char> header(HeaderSize(size), 0);
+  int ok = 1;
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle;
+  if (MPI_File_open(SU2_MPI::GetComm(), fileName.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle) !=
+      MPI_SUCCESS) {
+    return false;
+  }
+
+  /*--- The master checks the header, the other ranks then check their entry. ---*/
+
+  if (rank == MASTER_NODE) {
+    MPI_Status status;
+    MPI_File_read_at(fileHandle, 0, header.data(), header.size(), MPI_BYTE, &status);
+    int nRead = 0;
+    MPI_Get_count(&status, MPI_BYTE, &nRead);
+    ok = (static_cast<size_t>(nRead) == header.size());
+  }
+#else
+  FILE* fileHandle = fopen(fileName.c_str(), "rb");
+  if (fileHandle == nullptr) return false;
+  ok = fread(header.data(), 1, header.size(), fileHandle) == header.size();
+#endif
+
+  const uint64_t* values = reinterpret_cast<const uint64_t*>(header.data() + magicSize);
+  if (rank == MASTER_NODE) {
+    ok = ok && (strncmp(header.data(), magic, magicSize) == 0) && (values[0] == static_cast<uint64_t>(size)) &&
+         (values[1] == key);
+  }
+  SU2_MPI::Bcast(&ok, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (ok) {
+    SU2_MPI::Bcast(header.data(), header.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+    const uint64_t* table = values + 2;
+    ok = (table[2 * rank] == localKey) && (table[2 * rank + 1] == localData.size());
+
+    int allOk = 0;
+    SU2_MPI::Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+    ok = allOk;
+
+    if (ok) {
+      uint64_t offset = HeaderSize(size);
+      for (int iRank = 0; iRank < rank; ++iRank) offset += table[2 * iRank + 1];
+#ifdef HAVE_MPI
+      ok = TransferAll(fileHandle, offset, localData.data(), localData.size(), false);
+      SU2_MPI::Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+      ok = allOk;
+#else
+      ok = (fseek(fileHandle, offset, SEEK_SET) == 0) &&
+           (fread(localData.data(), 1, localData.size(), fileHandle) == localData.size());
+#endif
+    }
+  }
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+  return ok != 0;
+}
@@ -0,0 +1,78 @@
+/*!
+ * \file CMemoryMappedFile.cpp
+ * \brief Implementation of the read-only memory mapping of a file.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CMemoryMappedFile.hpp"
+
+#if defined(_WIN32) || defined(_WIN64) || defined(__WINDOWS__)
+#define SU2_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool CMemoryMappedFile::IsSupported() {
+#ifdef SU2_NO_MMAP
+  return false;
+#else
+  return true;
+#endif
+}
+
+bool CMemoryMappedFile::Open(const std::string& fileName) {
+  Close();
+#ifdef SU2_NO_MMAP
+  return false;
+#else
+  const int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(info.st_size);
+
+  /*--- The mapping remains valid after closing the descriptor. ---*/
+  void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) return false;
+
+  ptr = static_cast<const char*>(addr);
+  nBytes = size;
+  return true;
+#endif
+}
+
+void CMemoryMappedFile::Close() {
+#ifndef SU2_NO_MMAP
+  if (ptr != nullptr) munmap(const_cast<char*>(ptr), nBytes);
+#endif
+  ptr = nullptr;
+  nBytes = 0;
+}
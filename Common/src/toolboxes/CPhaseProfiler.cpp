@@ -0,0 +1,224 @@
+/*!
+ * \file CPhaseProfiler.cpp
+ * \brief Implementation of the hierarchical phase timer.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPhaseProfiler.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(__WINDOWS__)
+#define SU2_NO_RUSAGE
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+void CPhaseProfiler::Start(const std::string& name) {
+  const std::string path = stack.empty() ? name : phases[stack.back().first].path + "/" + name;
+
+  size_t iPhase = 0;
+  while (iPhase < phases.size() && phases[iPhase].path != path) ++iPhase;
+
+  if (iPhase == phases.size()) {
+    PhaseData data;
+    data.path = path;
+    data.depth = stack.size();
+    data.nCalls = 0;
+    data.time = 0.0;
+    data.memPeak = 0.0;
+    data.memGrowth = 0.0;
+    phases.push_back(data);
+  }
+  ++phases[iPhase].nCalls;
+
+  /*--- The high-water mark is reset for each phase, what was reached so far counts for the active phases. ---*/
+  const double peak = PeakMemory();
+  for (auto& parentPeak : stackPeak) parentPeak = std::max(parentPeak, peak);
+  ResetPeakMemory();
+
+  startMemory.push_back(CurrentMemory());
+  stackPeak.push_back(startMemory.back());
+  stack.emplace_back(iPhase, SU2_MPI::Wtime());
+}
+
+void CPhaseProfiler::Stop() {
+  if (stack.empty()) SU2_MPI::Error("No phase was started.", CURRENT_FUNCTION);
+
+  auto& data = phases[stack.back().first];
+  data.time += SU2_MPI::Wtime() - stack.back().second;
+  const double peak = std::max(stackPeak.back(), PeakMemory());
+  data.memPeak = std::max(data.memPeak, peak);
+  data.memGrowth += CurrentMemory() - startMemory.back();
+
+  stack.pop_back();
+  startMemory.pop_back();
+  stackPeak.pop_back();
+
+  /*--- The parent includes the peak of its children. ---*/
+  if (!stackPeak.empty()) stackPeak.back() = std::max(stackPeak.back(), peak);
+}
+
+double CPhaseProfiler::CurrentMemory() {
+#if defined(__linux__)
+  /*--- The second entry of statm is the resident set size in pages. ---*/
+  std::ifstream statm("/proc/self/statm");
+  unsigned long pages = 0, resident = 0;
+  if (!(statm >> pages >> resident)) return 0.0;
+  return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+#else
+  return 0.0;
+#endif
+}
+
+bool CPhaseProfiler::ResetPeakMemory() {
+#if defined(__linux__)
+  /*--- Writing 5 to clear_refs resets VmHWM (Linux >= 4.0), it may be disallowed in some containers. ---*/
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  clearRefs << "5";
+  clearRefs.close();
+  return !clearRefs.fail();
+#else
+  return false;
+#endif
+}
+
+double CPhaseProfiler::PeakMemory() {
+#if defined(__linux__)
+  /*--- Unlike ru_maxrss, VmHWM can be reset (see ResetPeakMemory). ---*/
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  double kiloBytes = 0.0;
+  while (status >> key) {
+    if (key == "VmHWM:") {
+      if (status >> kiloBytes) return kiloBytes / 1024.0;
+      break;
+    }
+    status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+#endif
+#ifdef SU2_NO_RUSAGE
+  return 0.0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / (1024.0 * 1024.0);  // bytes
+#else
+  return usage.ru_maxrss / 1024.0;  // kilobytes
+#endif
+#endif
+}
+
+void CPhaseProfiler::Report(const std::string& title, const std::string& jsonFileName, std::ostream* out) const {
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Reduce the times (min, sum, max) and memory (max, sum, max) of all phases at once. ---*/
+
+  const int nPhase = phases.size();
+  std::vector<double> local(3 * nPhase), minVal(3 * nPhase), sumVal(3 * nPhase), maxVal(3 * nPhase);
+  for (int i = 0; i < nPhase; ++i) {
+    local[3 * i] = phases[i].time;
+    local[3 * i + 1] = phases[i].memPeak;
+    local[3 * i + 2] = phases[i].memGrowth;
+  }
+  if (size > SINGLE_NODE) {
+    const auto comm = SU2_MPI::GetComm();
+    MPI_Wrapper::Reduce(local.data(), minVal.data(), 3 * nPhase, MPI_DOUBLE, MPI_MIN, MASTER_NODE, comm);
+    MPI_Wrapper::Reduce(local.data(), sumVal.data(), 3 * nPhase, MPI_DOUBLE, MPI_SUM, MASTER_NODE, comm);
+    MPI_Wrapper::Reduce(local.data(), maxVal.data(), 3 * nPhase, MPI_DOUBLE, MPI_MAX, MASTER_NODE, comm);
+  } else {
+    minVal = sumVal = maxVal = local;
+  }
+
+  if (rank != MASTER_NODE) return;
+
+  if (out) PrintTable(title, minVal, sumVal, maxVal, size, *out);
+
+  if (jsonFileName.empty()) return;
+
+  std::ofstream file(jsonFileName);
+  if (!file.is_open()) {
+    std::cout << "WARNING: Could not write the profiling results to " << jsonFileName << "." << std::endl;
+    return;
+  }
+  file.precision(8);
+  file << "{\n  \"title\": \"" << title << "\",\n  \"ranks\": " << size << ",\n  \"phases\": [";
+  for (int i = 0; i < nPhase; ++i) {
+    file << (i ? ",\n" : "\n") << "    {\"name\": \"" << phases[i].path << "\", \"depth\": " << phases[i].depth
+         << ", \"calls\": " << phases[i].nCalls << ", \"time_min\": " << minVal[3 * i]
+         << ", \"time_avg\": " << sumVal[3 * i] / size << ", \"time_max\": " << maxVal[3 * i]
+         << ", \"memory_hwm_max_mb\": " << maxVal[3 * i + 1] << ", \"memory_hwm_sum_mb\": " << sumVal[3 * i + 1]
+         << ", \"memory_growth_max_mb\": " << maxVal[3 * i + 2] << "}";
+  }
+  file << "\n  ]\n}\n";
+}
+
+void CPhaseProfiler::PrintTable(const std::string& title, const std::vector<double>& minVal,
+                                const std::vector<double>& sumVal, const std::vector<double>& maxVal,
+                                int size, std::ostream& out) const {
+  const int nPhase = phases.size();
+
+  /*--- Indented table with the leaf name of each phase. ---*/
+
+  std::vector<std::string> names(nPhase);
+  size_t nameWidth = 5;
+  for (int i = 0; i < nPhase; ++i) {
+    const auto& path = phases[i].path;
+    const auto pos = path.rfind('/');
+    names[i] = std::string(2 * phases[i].depth, ' ') + (pos == std::string::npos ? path : path.substr(pos + 1));
+    nameWidth = std::max(nameWidth, names[i].size());
+  }
+
+  out << "\n" << title << " (" << size << " rank" << (size > 1 ? "s" : "") << ")\n";
+
+  PrintingToolbox::CTablePrinter table(&out);
+  table.AddColumn("Phase", nameWidth);
+  table.AddColumn("Calls", 6);
+  table.AddColumn("Min [s]", 10);
+  table.AddColumn("Avg [s]", 10);
+  table.AddColumn("Max [s]", 10);
+  table.AddColumn("HWM max [MB]", 12);
+  table.AddColumn("HWM sum [MB]", 12);
+  table.AddColumn("Growth [MB]", 11);
+  table.SetPrecision(4);
+  table.PrintHeader();
+  for (int i = 0; i < nPhase; ++i) {
+    table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    table << names[i];
+    table.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+    table << phases[i].nCalls << minVal[3 * i] << sumVal[3 * i] / size << maxVal[3 * i];
+    table << static_cast<long>(maxVal[3 * i + 1]) << static_cast<long>(sumVal[3 * i + 1])
+          << static_cast<long>(maxVal[3 * i + 2]);
+  }
+  table.PrintFooter();
+  out << std::endl;
+}
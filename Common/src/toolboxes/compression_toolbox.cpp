@@ -0,0 +1,133 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Block compression of floating point arrays.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "../../include/toolboxes/compression_toolbox.hpp"
+
+namespace {
+
+constexpr uint64_t SIGN_MASK = uint64_t(1) << 63;
+constexpr uint64_t EXPONENT_MASK = uint64_t(0x7FF) << 52;
+
+/*--- Number of leading zero bytes, 8 for zero. ---*/
+inline int LeadingZeroBytes(uint64_t x) {
+  int n = 8;
+  while (x) {
+    x >>= 8;
+    --n;
+  }
+  return n;
+}
+
+/*--- Round away the low bits of a double and shift them out, the result is exact for droppedBits = 0. ---*/
+inline uint64_t Quantize(double value, int droppedBits) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(double));
+  if (droppedBits == 0) return bits;
+
+  const uint64_t sign = bits & SIGN_MASK;
+  const uint64_t magnitude = bits & ~SIGN_MASK;
+  uint64_t rounded = magnitude;
+
+  /*--- Round to nearest (a carry into the exponent is correct), unless this would create inf/nan. ---*/
+  if ((magnitude & EXPONENT_MASK) != EXPONENT_MASK) {
+    rounded += uint64_t(1) << (droppedBits - 1);
+    if ((rounded & EXPONENT_MASK) == EXPONENT_MASK) rounded = magnitude;
+  }
+  return (sign | rounded) >> droppedBits;
+}
+
+inline double Dequantize(uint64_t q, int droppedBits) {
+  const uint64_t bits = q << droppedBits;
+  double value;
+  memcpy(&value, &bits, sizeof(double));
+  return value;
+}
+
+}  // namespace
+
+int CompressionToolbox::DroppedBits(double tol) {
+  if (!(tol > 0)) return 0;
+
+  /*--- Rounding to m mantissa bits gives a relative error of at most 2^-(m+1). ---*/
+  const int keep = static_cast<int>(std::ceil(-std::log2(tol))) - 1;
+  if (keep >= 52) return 0;
+  return 52 - std::max(keep, 0);
+}
+
+void CompressionToolbox::CompressBlock(const double* data, unsigned long nPoint, unsigned long nField,
+                                       const int* droppedBits, std::vector<uint8_t>& buffer) {
+  const unsigned long nHeader = (nPoint + 1) / 2;
+
+  for (auto iField = 0ul; iField < nField; ++iField) {
+    /*--- Two 4-bit headers (number of leading zero bytes) per byte, followed by the non-zero bytes. ---*/
+    const auto headerPos = buffer.size();
+    buffer.resize(headerPos + nHeader, 0);
+
+    uint64_t prev = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const uint64_t q = Quantize(data[iPoint * nField + iField], droppedBits[iField]);
+      uint64_t residual = q ^ prev;
+      prev = q;
+
+      const int nZero = LeadingZeroBytes(residual);
+      buffer[headerPos + iPoint / 2] |= uint8_t(nZero << (4 * (iPoint % 2)));
+
+      for (int iByte = 0; iByte < 8 - nZero; ++iByte) {
+        buffer.push_back(uint8_t(residual & 0xFF));
+        residual >>= 8;
+      }
+    }
+  }
+}
+
+bool CompressionToolbox::DecompressBlock(const uint8_t* buffer, unsigned long nBytes, unsigned long nPoint,
+                                         unsigned long nField, const int* droppedBits, double* data) {
+  const unsigned long nHeader = (nPoint + 1) / 2;
+  unsigned long pos = 0;
+
+  for (auto iField = 0ul; iField < nField; ++iField) {
+    if (pos + nHeader > nBytes) return false;
+    const uint8_t* header = buffer + pos;
+    pos += nHeader;
+
+    uint64_t prev = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const int nZero = (header[iPoint / 2] >> (4 * (iPoint % 2))) & 0xF;
+      if (nZero > 8 || pos + 8 - nZero > nBytes) return false;
+
+      uint64_t residual = 0;
+      for (int iByte = 0; iByte < 8 - nZero; ++iByte) residual |= uint64_t(buffer[pos++]) << (8 * iByte);
+
+      prev ^= residual;
+      data[iPoint * nField + iField] = Dequantize(prev, droppedBits[iField]);
+    }
+  }
+  return pos == nBytes;
+}
@@ -28,6 +28,13 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+#include <map>
+#include <memory>
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -55,6 +62,40 @@ protected:
   COutput *direct_output;
   CNumerics ***numerics;                        /*!< \brief Container vector with all the numerics. */
 
+  std::unique_ptr<CBinomialCheckpointing> directSchedule; /*!< \brief Which direct states of the unsteady adjoint are stored. */
+  std::map<int, su2passivematrix> directCheckpoints; /*!< \brief Stored direct states (time levels n and n-1) by time iteration. */
+  std::map<int, su2passivematrix> directSolutions;   /*!< \brief Direct solutions needed by the current adjoint time iteration. */
+
+  /*!
+   * \brief Product with the operator of the adjoint system, one evaluation of the tape without the objective function,
+   * i.e. v = G^T u - u (times the relaxation factor) where G is the Jacobian of the recorded iteration.
+   */
+  class AdjointProduct : public CMatrixVectorProduct<passivedouble> {
+  public:
+    CDiscAdjSinglezoneDriver* const driver;
+
+    explicit AdjointProduct(CDiscAdjSinglezoneDriver* d) : driver(d) {}
+
+    inline void operator()(const CSysVector<passivedouble> & u, CSysVector<passivedouble> & v) const override {
+      driver->SetAllSolutions(ZONE_0, true, u);
+      driver->EvaluateAdjoint(false);
+      driver->GetAllSolutions(ZONE_0, true, v);
+      v -= u;
+    }
+  };
+
+  class Identity : public CPreconditioner<passivedouble> {
+  public:
+    inline bool IsIdentity() const override { return true; }
+    inline void operator()(const CSysVector<passivedouble> & u, CSysVector<passivedouble> & v) const override { v = u; }
+  };
+
+  /*!< \brief Members to use FGMRES to accelerate the adjoint iterations (alternative to quasi-Newton). */
+  static constexpr unsigned long KrylovMinIters = 3;
+  const passivedouble KrylovTol = 0.01;
+  CSysSolve<passivedouble> LinSolver;
+  CSysVector<passivedouble> AdjRHS, AdjSol, AdjStart;
+
   /*!
    * \brief Record one iteration of a flow iteration in within multiple zones.
    * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
@@ -82,11 +123,56 @@ protected:
    */
   void MainRecording(void);
 
+  /*!
+   * \brief Evaluate the tape once and extract the new adjoint solution.
+   * \param[in] seedObjective - Whether to seed the objective function (false for products with the adjoint operator).
+   */
+  void EvaluateAdjoint(bool seedObjective);
+
+  /*!
+   * \brief Correct the solution before the last adjoint iteration with FGMRES (one restart cycle), such that it
+   * solves the adjoint system, the transposed Jacobian and its preconditioner are part of the recorded iteration.
+   * \param[in] maxIter - Maximum number of tape evaluations.
+   * \return Number of tape evaluations.
+   */
+  unsigned long KrylovCorrection(unsigned long maxIter);
+
   /*!
    * \brief Record the secondary computational path.
    */
   void SecondaryRecording(void);
 
+  /*!
+   * \brief Compute the direct solutions that the unsteady adjoint iteration loads at the current time iteration,
+   * from the stored direct states instead of restart files.
+   */
+  void PrepareDirectSolutions();
+
+  /*!
+   * \brief Compute the direct solution of a time iteration, starting from the closest stored state.
+   * \param[in] directIter - Direct time iteration, smaller than in the previous call.
+   * \param[out] solution - Solutions of all direct solvers (same layout as GetAllSolutions).
+   */
+  void ComputeDirectSolution(int directIter, su2passivematrix& solution);
+
+  /*!
+   * \brief Advance the direct solution by one physical time step.
+   * \param[in] directIter - Direct time iteration to compute.
+   */
+  void DirectTimeStep(int directIter);
+
+  /*!
+   * \brief Get the time levels n (and n-1 for 2nd order) of all direct solvers.
+   * \param[out] state - The time levels next to each other, one row per point.
+   */
+  void GetDirectTimeLevels(su2passivematrix& state) const;
+
+  /*!
+   * \brief Set the time levels n (and n-1 for 2nd order) of all direct solvers, the solution is set to time level n.
+   * \param[in] state - Obtained with GetDirectTimeLevels.
+   */
+  void SetDirectTimeLevels(const su2passivematrix& state);
+
   /*!
    * \brief gets Convergence on physical time scale, (deactivated in adjoint case)
    * \return false
@@ -30,6 +30,7 @@
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
 #include "../integration/CIntegration.hpp"
 #include "../interfaces/CInterface.hpp"
 #include "../solvers/CSolver.hpp"
@@ -64,6 +65,8 @@ class CDriver : public CDriverBase {
   su2double MDOFs;   /*!< \brief Total number of DOFs in millions in the calculation (including ghost points).*/
   su2double MDOFsDomain; /*!< \brief Total number of DOFs in millions in the calculation (excluding ghost points).*/
 
+  CPhaseProfiler PreprocProfiler; /*!< \brief Time and memory of the preprocessing phases. */
+
   bool StopCalc,   /*!< \brief Stop computation flag.*/
       mixingplane, /*!< \brief mixing-plane simulation flag.*/
       fsi,         /*!< \brief FSI simulation flag.*/
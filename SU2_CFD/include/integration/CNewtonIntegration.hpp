@@ -47,7 +47,8 @@
  * \class CNewtonIntegration
  * \ingroup Drivers
  * \brief Class for time integration using a Newton-Krylov method, based
- * on matrix-free products with the true Jacobian via finite differences.
+ * on matrix-free products with the true Jacobian via finite differences,
+ * or via forward mode AD in the direct differentiation build.
  * \author P. Gomes
  */
 class CNewtonIntegration final : public CIntegration {
@@ -67,6 +68,7 @@ private:
   enum class ResEvalType {EXPLICIT, DEFAULT};
 
   bool setup = false;
+  bool adProducts = false; /*!< \brief Use forward mode AD for the matrix-free products. */
   Scalar finDiffStepND = 0.0;
   Scalar finDiffStep = 0.0; /*!< \brief Based on RMS(solution), used in matrix-free products. */
   unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
@@ -181,6 +183,12 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Matrix-free product via forward mode AD, the solution is seeded with the
+   * direction and the derivative of the residual is the product (no step size).
+   */
+  void MatrixFreeProductAD(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
+
 public:
   /*!
    * \brief Constructor.
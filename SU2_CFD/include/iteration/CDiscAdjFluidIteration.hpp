@@ -41,6 +41,7 @@ class CFluidIteration;
 class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
+  std::function<void(int)> loadDirectSolution; /*!< \brief Replaces the restart files of the direct solution if set. */
 
   /*!
    * \brief load unsteady solution for unsteady problems
@@ -147,6 +148,12 @@ class CDiscAdjFluidIteration final : public CIteration {
   void RegisterOutput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                       unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief Obtain the direct solutions of the unsteady adjoint from memory instead of restart files.
+   * \param[in] loader - Sets the direct solutions (finest mesh) of a given direct time iteration.
+   */
+  void SetDirectSolutionLoader(std::function<void(int)> loader) override { loadDirectSolution = std::move(loader); }
+
   /*!
    * \brief Compute necessary variables that depend on the conservative variables or the mesh node positions
    * (e.g. turbulent variables, normals, volumes).
@@ -37,6 +37,8 @@
 #include "../integration/CIntegration.hpp"
 #include "../output/CTurboOutput.hpp"
 
+#include <functional>
+
 using namespace std;
 
 class COutput;
@@ -295,4 +297,10 @@ class CIteration {
 
   virtual void RegisterOutput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                               unsigned short iZone, unsigned short iInst) {}
+
+  /*!
+   * \brief Obtain the direct solutions of the unsteady adjoint from memory instead of restart files.
+   * \param[in] loader - Sets the direct solutions (finest mesh) of a given direct time iteration.
+   */
+  virtual void SetDirectSolutionLoader(std::function<void(int)> loader) {}
 };
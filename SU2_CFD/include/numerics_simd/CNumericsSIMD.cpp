@@ -29,8 +29,11 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/scalar_fluxes.hpp"
 
 namespace {
 
@@ -44,6 +47,21 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -55,7 +73,15 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
  */
 template<class ViscousDecorator>
 CNumericsSIMD* createUpwindGeneralNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
-  return nullptr;
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case UPWIND::ROE:
+      obj = new CGeneralRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    default:
+      break;
+  }
+  return obj;
 }
 
 /*!
@@ -94,6 +120,7 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
 
   switch (config.GetKind_ConvNumScheme_Flow()) {
     case SPACE_UPWIND:
+      if (!CNumericsSIMD::SupportsUpwindScheme(config, iMesh)) break;
       if (config.GetViscous()) {
         if (ideal_gas)
           obj = createUpwindIdealNumerics<CCompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
@@ -126,8 +153,68 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Species factory implementation, the number of species is a template parameter.
+ */
+template<class FlowIndices, int nDim>
+CNumericsSIMD* createSpeciesNumerics(const CConfig& config, int nVar, const CVariable* flowVars) {
+  switch (nVar) {
+    case 1: return new CSpeciesFlux<FlowIndices,nDim,1>(config, flowVars);
+    case 2: return new CSpeciesFlux<FlowIndices,nDim,2>(config, flowVars);
+    case 3: return new CSpeciesFlux<FlowIndices,nDim,3>(config, flowVars);
+    case 4: return new CSpeciesFlux<FlowIndices,nDim,4>(config, flowVars);
+    default: return nullptr;
+  }
+}
+
+/*!
+ * \brief Scalar factory implementation.
+ */
+template<class FlowIndices, int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, int nVar, ScalarModel model,
+                                    const CVariable* flowVars, const su2double* constants) {
+  CNumericsSIMD* obj = nullptr;
+  switch (model) {
+    case ScalarModel::SA:
+      if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+        obj = new CTurbSAFlux<FlowIndices,nDim,true>(config, flowVars);
+      else
+        obj = new CTurbSAFlux<FlowIndices,nDim,false>(config, flowVars);
+      break;
+    case ScalarModel::SST:
+      obj = new CTurbSSTFlux<FlowIndices,nDim>(config, flowVars, constants);
+      break;
+    case ScalarModel::SPECIES:
+      obj = createSpeciesNumerics<FlowIndices,nDim>(config, nVar, flowVars);
+      break;
+  }
+  return obj;
+}
+
 } // namespace
 
+bool CNumericsSIMD::SupportsUpwindScheme(const CConfig& config, int iMesh) {
+  const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config.GetKind_FluidModel() == IDEAL_GAS);
+  const bool implicit = (config.GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  switch (config.GetKind_Upwind_Flow()) {
+    case UPWIND::ROE:
+      /*--- The secondary variables of general gases are not reconstructed. ---*/
+      return ideal_gas || !(config.GetMUSCL_Flow() && iMesh == MESH_0);
+    case UPWIND::HLLC:
+      return ideal_gas;
+    case UPWIND::AUSMPLUSUP:
+    case UPWIND::AUSMPLUSUP2:
+    case UPWIND::SLAU:
+    case UPWIND::SLAU2:
+      /*--- Only implemented for ideal gases, and only with the Roe-type approximate Jacobians. ---*/
+      return ideal_gas && !(implicit && config.GetUse_Accurate_Jacobians());
+    default:
+      return false;
+  }
+}
+
 /*!
  * \brief This function instantiates both 2D and 3D versions of the implementation in
  * createNumerics, which in turn instantiates the class templates of the different
@@ -145,3 +232,25 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, int nVar, ScalarModel model,
+                                                   const CVariable* flowVars, const su2double* constants) {
+  /*--- The bounded scalar correction is not a flux, and NEMO primitives are indexed differently. ---*/
+  const bool turb = (model != ScalarModel::SPECIES);
+  const auto kindScheme = turb ? config.GetKind_ConvNumScheme_Turb() : config.GetKind_ConvNumScheme_Species();
+  const bool bounded = turb ? config.GetBounded_Turb() : config.GetBounded_Species();
+
+  if (kindScheme != SPACE_UPWIND || bounded || config.GetNEMOProblem() || !flowVars) return nullptr;
+
+  using CompIndices = CEulerVariable::CIndices<unsigned long>;
+  using IncIndices = CIncEulerVariable::CIndices<unsigned long>;
+
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (nDim == 2) return createScalarNumerics<IncIndices,2>(config, nVar, model, flowVars, constants);
+    if (nDim == 3) return createScalarNumerics<IncIndices,3>(config, nVar, model, flowVars, constants);
+  } else {
+    if (nDim == 2) return createScalarNumerics<CompIndices,2>(config, nVar, model, flowVars, constants);
+    if (nDim == 3) return createScalarNumerics<CompIndices,3>(config, nVar, model, flowVars, constants);
+  }
+  return nullptr;
+}
@@ -37,6 +37,12 @@
  */
 enum class UpdateType {COLORING, REDUCTION};
 
+/*!
+ * \enum ScalarModel
+ * \brief Scalar transport models that have vectorized edge fluxes.
+ */
+enum class ScalarModel {SA, SST, SPECIES};
+
 /*!
  * \brief Define Double and Int SIMD types.
  */
@@ -97,4 +103,25 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Check if the upwind scheme and gas model in use have a vectorized implementation.
+   * \param[in] config - Problem definitions.
+   * \param[in] iMesh - Grid index.
+   * \return True if CreateNumerics can create the upwind numerics.
+   */
+  static bool SupportsUpwindScheme(const CConfig& config, int iMesh);
+
+  /*!
+   * \brief Factory method for the convective and viscous edge fluxes of scalar transport equations.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] nVar - Number of scalar variables.
+   * \param[in] model - Scalar transport model.
+   * \param[in] flowVars - Flow variables (primitives).
+   * \param[in] constants - Constants of the model (only SST).
+   * \return Null if the model or the options in use do not have a vectorized implementation.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, int nVar, ScalarModel model,
+                                             const CVariable* flowVars, const su2double* constants = nullptr);
+
 };
@@ -0,0 +1,205 @@
+/*!
+ * \file adjoint_kernels.hpp
+ * \brief Hand-differentiated flux kernels, recorded as external functions of the AD tape.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../util.hpp"
+
+/*--- The kernels below compute one edge (scalar type T) and the reverse mode derivative of their
+ * outputs w.r.t. all inputs (x_b = (dy/dx)^T y_b). The primal part follows the order of operations of
+ * the corresponding SIMD functions. In reverse AD builds they replace the recording of those functions
+ * when the flux computation is not preaccumulated, e.g. with hybrid parallel AD and the reducer strategy,
+ * where each kernel then takes one external function on the tape instead of one statement per operation.
+ * This only pays off for kernels with many operations per input, an external function stores the
+ * primal value and identifier of each input (e.g. the inviscid flux would need as much tape as the
+ * Jacobian entries of its operations). ---*/
+
+/*!
+ * \class CViscousFluxKernel
+ * \ingroup ViscDiscr
+ * \brief Viscous flux (compressible flow) from the stress tensor and the heat flux, scaled by the face
+ * area, see stressTensor and viscousFlux. The mass flux is zero and therefore not an output.
+ * \note Inputs: velocity (nDim), viscosity, thermal conductivity, gradient of temperature and velocity
+ * ((nDim+1) x nDim, row-major), unit normal (nDim), area. Outputs: momentum (nDim) and energy fluxes.
+ */
+template<size_t nDim>
+struct CViscousFluxKernel {
+  static constexpr size_t nGrad = (nDim+1)*nDim;
+  static constexpr size_t nIn = nDim + 2 + nGrad + nDim + 1;
+  static constexpr size_t nOut = nDim+1;
+
+  template<class T>
+  static void primal(const T* x, T* y) {
+    const T* velocity = x;
+    const T& viscosity = x[nDim];
+    const T& conductivity = x[nDim+1];
+    const T* grad = x + nDim+2;
+    const T* normal = x + nDim+2+nGrad;
+    const T& area = x[2*nDim+2+nGrad];
+
+    T tau[nDim][nDim];
+    stressTensor(viscosity, grad, tau);
+
+    T energy = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      T proj = 0.0, work = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        proj += tau[iDim][jDim] * normal[jDim];
+        work += tau[iDim][jDim] * velocity[jDim];
+      }
+      y[iDim] = proj * area;
+      energy += normal[iDim] * (conductivity*grad[iDim] + work);
+    }
+    y[nDim] = energy * area;
+  }
+
+  template<class T>
+  static void reverse(const T* x, T* x_b, const T* y_b) {
+    const T* velocity = x;
+    const T& viscosity = x[nDim];
+    const T& conductivity = x[nDim+1];
+    const T* grad = x + nDim+2;
+    const T* normal = x + nDim+2+nGrad;
+    const T& area = x[2*nDim+2+nGrad];
+
+    for (size_t i = 0; i < nIn; ++i) x_b[i] = 0.0;
+    T* velocity_b = x_b;
+    T& viscosity_b = x_b[nDim];
+    T& conductivity_b = x_b[nDim+1];
+    T* grad_b = x_b + nDim+2;
+    T* normal_b = x_b + nDim+2+nGrad;
+    T& area_b = x_b[2*nDim+2+nGrad];
+
+    /*--- Recompute the stress tensor. ---*/
+
+    T tau[nDim][nDim];
+    stressTensor(viscosity, grad, tau);
+
+    /*--- Fluxes, the energy flux first. ---*/
+
+    const T energy_b = y_b[nDim] * area;
+    T tau_b[nDim][nDim];
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      T proj = 0.0, work = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        proj += tau[iDim][jDim] * normal[jDim];
+        work += tau[iDim][jDim] * velocity[jDim];
+      }
+      const T heat = conductivity*grad[iDim] + work;
+      area_b += y_b[iDim] * proj + y_b[nDim] * normal[iDim] * heat;
+
+      const T proj_b = y_b[iDim] * area;
+      normal_b[iDim] += energy_b * heat;
+      conductivity_b += energy_b * normal[iDim] * grad[iDim];
+      grad_b[iDim] += energy_b * normal[iDim] * conductivity;
+
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        tau_b[iDim][jDim] = energy_b * normal[iDim] * velocity[jDim] + proj_b * normal[jDim];
+        velocity_b[jDim] += energy_b * normal[iDim] * tau[iDim][jDim];
+        normal_b[jDim] += proj_b * tau[iDim][jDim];
+      }
+    }
+
+    /*--- Stress tensor. ---*/
+
+    T velDiv = 0.0, trace_b = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velDiv += grad[(iDim+1)*nDim + iDim];
+      trace_b += tau_b[iDim][iDim];
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        viscosity_b += tau_b[iDim][jDim] * (grad[(jDim+1)*nDim + iDim] + grad[(iDim+1)*nDim + jDim]);
+        grad_b[(jDim+1)*nDim + iDim] += tau_b[iDim][jDim] * viscosity;
+        grad_b[(iDim+1)*nDim + jDim] += tau_b[iDim][jDim] * viscosity;
+      }
+    }
+    viscosity_b -= 2.0/3.0 * velDiv * trace_b;
+    const T velDiv_b = -2.0/3.0 * viscosity * trace_b;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      grad_b[(iDim+1)*nDim + iDim] += velDiv_b;
+    }
+  }
+
+ private:
+  template<class T>
+  static void stressTensor(const T& viscosity, const T* grad, T (&tau)[nDim][nDim]) {
+    T velDiv = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velDiv += grad[(iDim+1)*nDim + iDim];
+    }
+    const T pTerm = 2.0/3.0 * viscosity * velDiv;
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        tau[iDim][jDim] = viscosity * (grad[(jDim+1)*nDim + iDim] + grad[(iDim+1)*nDim + jDim]);
+      }
+      tau[iDim][iDim] -= pTerm;
+    }
+  }
+};
+
+#ifdef CODI_REVERSE_TYPE
+/*!
+ * \brief Whether the kernels should be recorded as external functions, i.e. when the tape is
+ * recording and the flux computation is not being preaccumulated.
+ */
+FORCEINLINE bool useExternalKernels() { return AD::getTape().isActive() && !AD::PreaccActive; }
+
+/*!
+ * \class CExternalKernel
+ * \brief Records a hand-differentiated kernel as an external function of the AD tape (one per SIMD lane).
+ */
+template<class Kernel>
+struct CExternalKernel {
+  using Real = su2double::Real;
+
+  static void primal(const Real* x, size_t, Real* y, size_t, codi::ExternalFunctionUserData*) {
+    Kernel::primal(x, y);
+  }
+
+  static void reverse(const Real* x, Real* x_b, size_t, const Real*, const Real* y_b, size_t,
+                      codi::ExternalFunctionUserData*) {
+    Kernel::reverse(x, x_b, y_b);
+  }
+
+  /*!
+   * \brief Evaluate the kernel and record it.
+   * \param[in] in - Pointers to the inputs.
+   * \param[out] out - The outputs, they become new variables of the tape.
+   */
+  static void record(const Double* const (&in)[Kernel::nIn], VectorDbl<Kernel::nOut>& out) {
+    for (size_t k = 0; k < Double::Size; ++k) {
+      AD::ExtFuncHelper helper;
+      for (size_t i = 0; i < Kernel::nIn; ++i) helper.addInput((*in[i])[k]);
+      for (size_t i = 0; i < Kernel::nOut; ++i) helper.addOutput(out(i)[k]);
+      helper.callPrimalFunc(primal);
+      helper.addToTape(reverse);
+    }
+  }
+};
+#endif
@@ -0,0 +1,382 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM+up and SLAU family of convective schemes.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMPLUS_SLAU_Base
+ * \ingroup ConvDiscr
+ * \brief Base class for AUSM+up and SLAU type schemes, derived classes implement the face
+ * mass flux and pressure in a const "massAndPressureFluxes" method (see CUpwAUSMPLUS_SLAU_Base_Flow).
+ * The Jacobians are approximated with those of the Roe scheme.
+ * \note Like the scalar versions, these schemes do not account for grid velocities.
+ */
+template<class Derived, class Base>
+class CAUSMPLUS_SLAU_Base : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMPLUS_SLAU_Base(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Roe-type approximation of the flux Jacobians (no entropy fix).
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void approximateJacobians(const CPair<PrimVarType>& V,
+                                        const CPair<ConsVarType>& U,
+                                        const VectorDbl<nDim>& normal,
+                                        const VectorDbl<nDim>& unitNormal,
+                                        Double area,
+                                        MatrixDbl<nVar>& jac_i,
+                                        MatrixDbl<nVar>& jac_j) const {
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * projModJacTensor * area;
+        jac_j(iVar,jVar) -= 0.5 * projModJacTensor * area;
+      }
+    }
+  }
+
+public:
+  /*!
+   * \brief Implementation of the general form of the flux.
+   * F = ||A|| ( 0.5 * mdot * (psi_i+psi_j) - 0.5 * |mdot| * (psi_i-psi_j) + N * pf ), psi = (1, u, H).
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes defined by the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, iPoint, jPoint, solution, mdot, pressure);
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = 0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                     0.5*absMdot*(V.i.velocity(iDim) - V.j.velocity(iDim)) + unitNormal(iDim)*pressure;
+    }
+    flux(nVar-1) = 0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) + 0.5*absMdot*(V.i.enthalpy() - V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      CPair<CCompressibleConservatives<nDim> > U;
+      U.i = compressibleConservatives(V.i);
+      U.j = compressibleConservatives(V.j);
+      approximateJacobians(V, U, normal, unitNormal, area, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up (and AUSM+up2 if the template argument is true) by M.-S. Liou.
+ */
+template<class Decorator, bool UP2>
+class CAUSMPLUSUPScheme : public CAUSMPLUS_SLAU_Base<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator> {
+private:
+  using Base = CAUSMPLUS_SLAU_Base<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double mInf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    mInf(config.GetMach()) {
+    if (mInf < EPS)
+      SU2_MPI::Error(string(UP2? "AUSM+Up2" : "AUSM+Up") + " requires a reference Mach number "
+                     "(\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux (per unit area) and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int,
+                                         Int,
+                                         const CEulerVariable&,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    constexpr passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound. ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = pow(astarL,2) / fmax(astarL, projVel_i);
+    const Double ahatR = pow(astarR,2) / fmax(astarR, -projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right pressure functions and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, mInf*mInf));
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4 + 5*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    const Double subL = abs(mL) <= 1.0;
+    const Double p1L = 0.25*pow(mL+1,2);
+    const Double p2L = pow(mL*mL-1,2);
+    const Double mLP = subL*(p1L + beta*p2L) + (1-subL)*0.5*(mL+abs(mL));
+    const Double pLP = subL*(p1L*(2-mL) + alpha*mL*p2L) + (1-subL)*(mL > 0.0);
+
+    const Double subR = abs(mR) <= 1.0;
+    const Double p1R = 0.25*pow(mR-1,2);
+    const Double p2R = pow(mR*mR-1,2);
+    const Double mRM = subR*(-p1R - beta*p2R) + (1-subR)*0.5*(mR-abs(mR));
+    const Double pRM = subR*(p1R*(2+mR) - alpha*mR*p2R) + (1-subR)*(mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa)*fmax(1-sigma*MFsq, 0.0)*(V.j.pressure()-V.i.pressure())/(rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (fmax(mF,0.0)*V.i.density() + fmin(mF,0.0)*V.j.density());
+
+    if (!UP2) {
+      /*--- Pressure with velocity diffusion term. ---*/
+      const Double Pu = -Ku*fa*pLP*pRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = pLP*V.i.pressure() + pRM*V.j.pressure() + Pu;
+    }
+    else {
+      /*--- Modified pressure flux. ---*/
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(pLP-pRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(pLP+pRM-1)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU (and SLAU2 if the template argument is true) by E. Shima and K. Kitamura,
+ * optionally with the low dissipation blending of the Roe schemes.
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMPLUS_SLAU_Base<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMPLUS_SLAU_Base<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Face mass flux (per unit area) and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int iPoint,
+                                         Int jPoint,
+                                         const CEulerVariable& solution,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure()/V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure()/V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i-0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j-0.5*sqVel_j)));
+
+    /*--- Interface speed of sound, and left/right Mach number. ---*/
+
+    const Double aF = 0.5*(soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double machTilde = fmin(1.0, sqrt(0.5*(sqVel_i+sqVel_j)) / aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double fRho = -fmax(fmin(mL,0.0),-1.0) * fmin(fmax(mR,0.0),1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double vnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double vnMagL = (1-fRho)*vnMag + fRho*abs(projVel_i);
+    const Double vnMagR = (1-fRho)*vnMag + fRho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                  (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double betaL = subL*0.25*(2-mL)*pow(mL+1,2) + (1-subL)*(mL >= 0.0);
+    const Double subR = abs(mR) < 1.0;
+    const Double betaR = subR*0.25*(2+mR)*pow(mR-1,2) + (1-subR)*(mR < 0.0);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    }
+    else {
+      pressure += dissipation*sqrt(0.5*(sqVel_i+sqVel_j))*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    }
+  }
+};
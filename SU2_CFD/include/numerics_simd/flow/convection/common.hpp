@@ -342,6 +342,99 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Compute and return the P tensor (compressible flow, general gas).
+ * \note chi and kappa are the derivatives of pressure w.r.t. density and internal energy (see
+ * CUpwGeneralRoe_Flow), for an ideal gas chi = 0 and kappa = gamma-1, i.e. this reduces to pMatrix.
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> pMatrixGeneral(Double chi, Double kappa, Double density,
+                                             const RandomAccessIterator& velocity, Double projVel,
+                                             Double speedSound, Double enthalpy, const VectorDbl<nDim>& normal) {
+  auto pMat = pMatrix(kappa+1, density, velocity, projVel, speedSound, normal);
+
+  /*--- Correct the terms that depend on the equation of state. ---*/
+
+  const Double chiOnKappa = chi / kappa;
+  if (nDim == 2) {
+    pMat(nDim+1,0) -= chiOnKappa;
+  }
+  else {
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      pMat(nDim+1,iDim) -= chiOnKappa * normal(iDim);
+    }
+  }
+  const Double rhoOn2 = 0.5*density;
+  const Double rhoOnTwoC = rhoOn2 / speedSound;
+  pMat(nDim+1,nDim) = rhoOnTwoC * enthalpy + rhoOn2 * projVel;
+  pMat(nDim+1,nDim+1) = rhoOnTwoC * enthalpy - rhoOn2 * projVel;
+
+  return pMat;
+}
+
+/*!
+ * \brief Compute and return the inverse P tensor (compressible flow, general gas).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> pMatrixInvGeneral(Double chi, Double kappa, Double density,
+                                                const RandomAccessIterator& velocity, Double projVel,
+                                                Double speedSound, const VectorDbl<nDim>& normal) {
+  auto pMatInv = pMatrixInv(kappa+1, density, velocity, projVel, speedSound, normal);
+
+  /*--- Correct the terms that depend on the equation of state. ---*/
+
+  const Double chiOnC2 = chi / pow(speedSound,2);
+  if (nDim == 2) {
+    pMatInv(0,0) -= chiOnC2;
+  }
+  else {
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      pMatInv(iDim,0) -= chiOnC2 * normal(iDim);
+    }
+  }
+  const Double chiOnRhoC = chi / (density*speedSound);
+  pMatInv(nDim,0) += chiOnRhoC;
+  pMatInv(nDim+1,0) += chiOnRhoC;
+
+  return pMatInv;
+}
+
+/*!
+ * \brief Jacobian of the convective flux (compressible flow, general gas).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> inviscidProjJacGeneral(Double chi, Double kappa, RandomAccessIterator velocity,
+                                                     Double enthalpy, const VectorDbl<nDim>& normal,
+                                                     Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  Double projVel = dot(velocity, normal);
+  Double phi = chi + 0.5*kappa*squaredNorm<nDim>(velocity);
+
+  jac(0,0) = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * normal(iDim);
+  }
+  jac(0,nDim+1) = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim)*phi - velocity[iDim]*projVel);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * (normal(jDim)*velocity[iDim] - kappa*normal(iDim)*velocity[jDim]);
+    }
+    jac(iDim+1,iDim+1) += scale * projVel;
+    jac(iDim+1,nDim+1) = scale * kappa * normal(iDim);
+  }
+
+  jac(nDim+1,0) = scale * projVel * (phi-enthalpy);
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * (normal(iDim)*enthalpy - kappa*velocity[iDim]*projVel);
+  }
+  jac(nDim+1,nDim+1) = scale * (kappa+1) * projVel;
+
+  return jac;
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
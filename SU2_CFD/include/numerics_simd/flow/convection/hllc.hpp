@@ -0,0 +1,328 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (ideal gas), vectorized version of CUpwHLLC_Flow.
+ * \note The four regions of the Riemann fan (left, left star, right star, right) are
+ * evaluated without branches, the star state is computed once for the side on which it
+ * lies and the results are blended with 0/1 masks.
+ */
+template<class Decorator>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Jacobian of the star state flux w.r.t. the conservative variables of one side.
+   * \param[in] V - Primitives of the side.
+   * \param[in] projVel - Projected velocity of the side.
+   * \param[in] waveSpeed - Wave speed of the side (sL or sR).
+   * \param[in] sign - 1 for the left (i) side, -1 for the right (j).
+   * \param[in] ownSide - 1 if the star state is on this side, 0 otherwise.
+   * \param[in] dpFactor - Factor that converts dSm/dU into dpStar/dU.
+   * \param[in] sM, pStar, omega, RHO, starState - Contact speed and star state quantities.
+   * \param[in] normal - Unit normal.
+   */
+  template<class PrimVarType>
+  FORCEINLINE MatrixDbl<nVar> starJacobian(const PrimVarType& V, Double projVel, Double waveSpeed,
+                                           passivedouble sign, Double ownSide, Double dpFactor,
+                                           Double sM, Double pStar, Double omega, Double RHO,
+                                           const VectorDbl<nVar>& starState,
+                                           const VectorDbl<nDim>& normal) const {
+    const Double gm1 = gamma - 1;
+
+    /*--- Derivatives of the pressure. ---*/
+
+    VectorDbl<nVar> dPIdU;
+    dPIdU(0) = 0.5 * gm1 * squaredNorm<nDim>(V.velocity());
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dPIdU(iDim+1) = -gm1 * V.velocity(iDim);
+    }
+    dPIdU(nVar-1) = gm1;
+
+    /*--- Derivatives of the contact speed, pressure, and energy of the star state. ---*/
+
+    const Double starEnergy = starState(nVar-1);
+    const Double omegaSM = omega * sM;
+
+    VectorDbl<nVar> dSmdU, dpStardU, dEStardU;
+    dSmdU(0) = sign * (-pow(projVel,2) + sM*waveSpeed + dPIdU(0)) / RHO;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dSmdU(iDim+1) = sign * (normal(iDim)*(2*projVel - waveSpeed - sM) + dPIdU(iDim+1)) / RHO;
+    }
+    dSmdU(nVar-1) = sign * dPIdU(nVar-1) / RHO;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dpStardU(iVar) = dpFactor * dSmdU(iVar);
+      dEStardU(iVar) = omega * (sM*dpStardU(iVar) + (starEnergy+pStar)*dSmdU(iVar));
+    }
+    dEStardU(0) += ownSide * omega * projVel * (V.enthalpy() - dPIdU(0));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dEStardU(iDim+1) -= ownSide * omega * (normal(iDim)*V.enthalpy() + projVel*dPIdU(iDim+1));
+    }
+    dEStardU(nVar-1) += ownSide * omega * (waveSpeed - projVel - projVel*dPIdU(nVar-1));
+
+    /*--- Assemble, the terms multiplied by "ownSide" come from differentiating the
+     *    star state itself, which only depends on the side where it lies. ---*/
+
+    MatrixDbl<nVar> jac;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac(0,iVar) = starState(0) * (omegaSM+1) * dSmdU(iVar);
+    }
+    jac(0,0) += ownSide * omegaSM * waveSpeed;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(0,iDim+1) -= ownSide * omegaSM * normal(iDim);
+    }
+
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac(jDim+1,iVar) = (omegaSM+1) * (normal(jDim)*dpStardU(iVar) + starState(jDim+1)*dSmdU(iVar)) -
+                           ownSide * omegaSM * dPIdU(iVar) * normal(jDim);
+      }
+      jac(jDim+1,0) += ownSide * omegaSM * V.velocity(jDim) * projVel;
+      jac(jDim+1,jDim+1) += ownSide * omegaSM * (waveSpeed - projVel);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(jDim+1,iDim+1) -= ownSide * omegaSM * V.velocity(jDim) * normal(iDim);
+      }
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac(nVar-1,iVar) = sM * (dEStardU(iVar) + dpStardU(iVar)) + (starEnergy+pStar) * dSmdU(iVar);
+    }
+    return jac;
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Sound speeds and projected velocities, relative to the grid. ---*/
+
+    const Double gm1 = gamma - 1;
+    Double soundSpeed_i = sqrt(gm1 * (V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity())));
+    Double soundSpeed_j = sqrt(gm1 * (V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity())));
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      soundSpeed_i -= projGridVel;
+      soundSpeed_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averaged variables. ---*/
+
+    const Double sqrtRho_i = sqrt(V.i.density());
+    const Double sqrtRho_j = sqrt(V.j.density());
+    const Double D = 1 / (sqrtRho_i + sqrtRho_j);
+    VectorDbl<nDim> roeVelocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      roeVelocity(iDim) = (sqrtRho_i*V.i.velocity(iDim) + sqrtRho_j*V.j.velocity(iDim)) * D;
+    }
+    const Double roeProjVel = dot(roeVelocity, unitNormal) - projGridVel;
+    const Double roeEnthalpy = (sqrtRho_i*V.i.enthalpy() + sqrtRho_j*V.j.enthalpy()) * D;
+    const Double roeSoundSpeed = sqrt(gm1 * (roeEnthalpy - 0.5*squaredNorm(roeVelocity))) - projGridVel;
+
+    /*--- Wave speeds, speed of the contact surface, and pressure of the star states. ---*/
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    const Double RHO = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / RHO;
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- Masks for the regions of the Riemann fan. ---*/
+
+    const Double leftStar = sM > 0.0;
+    const Double rightStar = 1 - leftStar;
+    const Double supersonic_i = leftStar * (sL > 0.0);
+    const Double supersonic_j = rightStar * (sR < 0.0);
+    const Double subsonic = 1 - supersonic_i - supersonic_j;
+
+    /*--- Star state, computed from the side where it lies. ---*/
+
+    const Double waveSpeed = leftStar*sL + rightStar*sR;
+    const Double projVel = leftStar*projVel_i + rightStar*projVel_j;
+    const Double density = leftStar*V.i.density() + rightStar*V.j.density();
+    const Double pressure = leftStar*V.i.pressure() + rightStar*V.j.pressure();
+    const Double rhoEnergy = leftStar*U.i.rhoEnergy() + rightStar*U.j.rhoEnergy();
+
+    /*--- In the supersonic regions the denominator can vanish, the value does not matter there. ---*/
+    const Double omega = 1 / (subsonic*(waveSpeed-sM) + (1-subsonic));
+    const Double sMinusVel = waveSpeed - projVel;
+    const Double rhoStar = sMinusVel * omega;
+
+    VectorDbl<nVar> starState;
+    starState(0) = rhoStar * density;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double momentum = leftStar*U.i.momentum(iDim) + rightStar*U.j.momentum(iDim);
+      starState(iDim+1) = rhoStar * (momentum + (pStar-pressure)/sMinusVel * unitNormal(iDim));
+    }
+    starState(nVar-1) = rhoStar * (rhoEnergy - (pressure*projVel - pStar*sM)/sMinusVel);
+
+    /*--- Blend the fluxes of the three possible states. ---*/
+
+    VectorDbl<nVar> flux;
+    const Double mdot_i = supersonic_i * V.i.density() * projVel_i;
+    const Double mdot_j = supersonic_j * V.j.density() * projVel_j;
+    flux(0) = mdot_i + mdot_j + subsonic * sM * starState(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = mdot_i*V.i.velocity(iDim) + supersonic_i*V.i.pressure()*unitNormal(iDim) +
+                     mdot_j*V.j.velocity(iDim) + supersonic_j*V.j.pressure()*unitNormal(iDim) +
+                     subsonic * (sM*starState(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nVar-1) = mdot_i*V.i.enthalpy() + mdot_j*V.j.enthalpy() +
+                   subsonic * (sM*(starState(nVar-1)+pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians, blended in the same way as the flux. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const auto jacSuper_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), unitNormal, 1.0);
+      const auto jacSuper_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), unitNormal, 1.0);
+
+      const auto jacStar_i = starJacobian(V.i, projVel_i, sL, 1, leftStar, V.i.density()*(sR-projVel_j),
+                                          sM, pStar, omega, RHO, starState, unitNormal);
+      const auto jacStar_j = starJacobian(V.j, projVel_j, sR, -1, rightStar, V.j.density()*(sL-projVel_i),
+                                          sM, pStar, omega, RHO, starState, unitNormal);
+
+      /*--- Scale by kappa as the flux is ~ 0.5*(fc_i+fc_j)*Normal, as in CUpwHLLC_Flow. ---*/
+      const Double scale = kappa * area;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) = scale * (supersonic_i*jacSuper_i(iVar,jVar) + subsonic*jacStar_i(iVar,jVar));
+          jac_j(iVar,jVar) = scale * (supersonic_j*jacSuper_j(iVar,jVar) + subsonic*jacStar_j(iVar,jVar));
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
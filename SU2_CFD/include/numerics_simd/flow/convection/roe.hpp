@@ -297,3 +297,223 @@ public:
     }
   }
 };
+
+/*!
+ * \class CGeneralRoeScheme
+ * \ingroup ConvDiscr
+ * \brief Roe scheme for a general (non-ideal) gas, the thermodynamic derivatives of
+ * pressure are taken from the secondary variables of the solution (see CUpwGeneralRoe_Flow).
+ * \note Those variables are not reconstructed, as that requires the fluid model, therefore
+ * this class is only used when there is no MUSCL reconstruction.
+ */
+template<class Decorator>
+class CGeneralRoeScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double entropyFix;
+  const bool dynamicGrid;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CGeneralRoeScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    entropyFix(config.GetEntropyFix_Coeff()),
+    dynamicGrid(config.GetDynamic_Grid()) {
+  }
+
+  /*!
+   * \brief Implementation of the general gas Roe flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Primitives and derivatives of pressure (dP/drho_e, dP/de_rho). ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    const auto S_i = gatherVariables<2>(iPoint, solution.GetSecondary());
+    const auto S_j = gatherVariables<2>(jPoint, solution.GetSecondary());
+
+    const Double kappa_i = S_i(1) / V.i.density();
+    const Double kappa_j = S_j(1) / V.j.density();
+    const Double staticEnergy_i = V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity()) - V.i.pressure()/V.i.density();
+    const Double staticEnergy_j = V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity()) - V.j.pressure()/V.j.density();
+    const Double chi_i = S_i(0) - kappa_i*staticEnergy_i;
+    const Double chi_j = S_j(0) - kappa_j*staticEnergy_j;
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Roe averaged variables, the EOS derivatives are simple averages. ---*/
+
+    const Double R = sqrt(abs(V.j.density() / V.i.density()));
+    const Double D = 1 / (R+1);
+    const Double roeDensity = R * V.i.density();
+    VectorDbl<nDim> roeVelocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      roeVelocity(iDim) = (R*V.j.velocity(iDim) + V.i.velocity(iDim)) * D;
+    }
+    const Double roeEnthalpy = (R*V.j.enthalpy() + V.i.enthalpy()) * D;
+    const Double roeKappa = 0.5 * (kappa_i + kappa_j);
+    const Double roeChi = 0.5 * (chi_i + chi_j);
+    const Double roeSoundSpeed2 = roeChi + roeKappa * (roeEnthalpy - 0.5*squaredNorm(roeVelocity));
+    const Double roeProjVel = dot(roeVelocity, unitNormal);
+
+    /*--- Non-physical averages produce a null flux (and Jacobians). ---*/
+
+    const Double valid = roeSoundSpeed2 > 0.0;
+    const Double roeSoundSpeed = sqrt(fmax(roeSoundSpeed2, EPS));
+
+    /*--- P tensor. ---*/
+
+    auto pMat = pMatrixGeneral(roeChi, roeKappa, roeDensity, roeVelocity, roeProjVel,
+                               roeSoundSpeed, roeEnthalpy, unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0, projVel = roeProjVel;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      projVel -= projGridVel;
+    }
+
+    /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = projVel;
+    }
+    lambda(nDim) = projVel + roeSoundSpeed;
+    lambda(nDim+1) = projVel - roeSoundSpeed;
+
+    Double maxLambda = abs(projVel) + roeSoundSpeed;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambda(iVar) = fmax(abs(lambda(iVar)), entropyFix*maxLambda);
+    }
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidProjFlux(V.i, U.i, normal);
+    auto flux_j = inviscidProjFlux(V.j, U.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidProjJacGeneral(chi_i, kappa_i, V.i.velocity(), V.i.enthalpy(), normal, 0.5);
+      jac_j = inviscidProjJacGeneral(chi_j, kappa_j, V.j.velocity(), V.j.enthalpy(), normal, 0.5);
+    }
+
+    /*--- Roe dissipation. ---*/
+
+    auto pMatInv = pMatrixInvGeneral(roeChi, roeKappa, roeDensity, roeVelocity,
+                                     roeProjVel, roeSoundSpeed, unitNormal);
+
+    VectorDbl<nVar> deltaU;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      deltaU(iVar) = U.j.all(iVar) - U.i.all(iVar);
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        Double dDdU = projModJacTensor * (1-kappa) * area;
+
+        flux(iVar) -= dDdU * deltaU(jVar);
+
+        if (implicit) {
+          jac_i(iVar,jVar) += dDdU;
+          jac_j(iVar,jVar) -= dDdU;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Double dFdU = projGridVel * area * 0.5;
+        flux(iVar) -= dFdU * (U.i.all(iVar) + U.j.all(iVar));
+
+        if (implicit) {
+          jac_i(iVar,iVar) -= dFdU;
+          jac_j(iVar,iVar) -= dFdU;
+        }
+      }
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= valid;
+      if (implicit) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) *= valid;
+          jac_j(iVar,jVar) *= valid;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -30,6 +30,7 @@
 #include "../../CNumericsSIMD.hpp"
 #include "../../util.hpp"
 #include "../variables.hpp"
+#include "../adjoint_kernels.hpp"
 #include "../../../numerics/CNumerics.hpp"
 
 /*!
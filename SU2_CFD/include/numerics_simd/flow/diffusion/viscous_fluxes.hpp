@@ -151,30 +151,64 @@ protected:
     auto avgGrad = averageGradient<nPrimVarGrad,nDim>(iPoint, jPoint, gradient);
     if(correct) correctGradient(V, vector_ij, dist2_ij, avgGrad);
 
-    /*--- Stress and heat flux tensors. ---*/
-
-    auto tau = stressTensor(avgV.laminarVisc() + (uq? Double(0.0) : avgV.eddyVisc()), avgGrad);
-    if(useSA_QCR) addQCR(avgGrad, tau);
-    if(uq) {
-      Double turb_ke = 0.5*(gatherVariables(iPoint, turbVars->GetSolution()) +
-                            gatherVariables(jPoint, turbVars->GetSolution()));
-      addPerturbedRSM(avgV, avgGrad, turb_ke, tau,
-                      uq_eigval_comp, uq_permute, uq_delta_b, uq_urlx);
-    }
+    Double cond = derived->thermalConductivity(avgV);
+    VectorDbl<nVar> viscFlux;
+
+#ifdef CODI_REVERSE_TYPE
+    /*--- Hand-differentiated flux, for the models without modifications of the stress tensor. ---*/
+
+    if (useExternalKernels() && !useSA_QCR && !uq && !wallFun) {
+      using Kernel = CViscousFluxKernel<nDim>;
+      static_assert(Kernel::nOut == nVar-1, "");
+      const Double viscosity = avgV.laminarVisc() + avgV.eddyVisc();
+      const Double* in[Kernel::nIn];
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        in[iDim] = &avgV.velocity(iDim);
+        in[nDim+2+Kernel::nGrad+iDim] = &unitNormal(iDim);
+      }
+      in[nDim] = &viscosity;
+      in[nDim+1] = &cond;
+      for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          in[nDim+2+iVar*nDim+iDim] = &avgGrad(iVar,iDim);
+        }
+      }
+      in[2*nDim+2+Kernel::nGrad] = &area;
+
+      VectorDbl<Kernel::nOut> out;
+      CExternalKernel<Kernel>::record(in, out);
+      viscFlux(0) = 0.0;
+      for (size_t iVar = 1; iVar < nVar; ++iVar) viscFlux(iVar) = out(iVar-1);
+    } else
+#endif
+    {
+      /*--- Stress and heat flux tensors. ---*/
+
+      auto tau = stressTensor(avgV.laminarVisc() + (uq? Double(0.0) : avgV.eddyVisc()), avgGrad);
+      if(useSA_QCR) addQCR(avgGrad, tau);
+      if(uq) {
+        Double turb_ke = 0.5*(gatherVariables(iPoint, turbVars->GetSolution()) +
+                              gatherVariables(jPoint, turbVars->GetSolution()));
+        addPerturbedRSM(avgV, avgGrad, turb_ke, tau,
+                        uq_eigval_comp, uq_permute, uq_delta_b, uq_urlx);
+      }
 
-    if(wallFun) addTauWall(iPoint, jPoint, solution.GetTau_Wall(), unitNormal, tau);
+      if(wallFun) addTauWall(iPoint, jPoint, solution.GetTau_Wall(), unitNormal, tau);
 
-    Double cond = derived->thermalConductivity(avgV);
-    VectorDbl<nDim> heatFlux;
-    for (size_t iDim = 0; iDim < nDim; ++iDim) {
-      heatFlux(iDim) = cond * avgGrad(0,iDim);
-    }
+      VectorDbl<nDim> heatFlux;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        heatFlux(iDim) = cond * avgGrad(0,iDim);
+      }
+
+      /*--- Projected flux. ---*/
 
-    /*--- Projected flux. ---*/
+      viscFlux = viscousFlux<nVar>(avgV, tau, heatFlux, unitNormal);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        viscFlux(iVar) *= area;
+      }
+    }
 
-    auto viscFlux = viscousFlux<nVar>(avgV, tau, heatFlux, unitNormal);
     for (size_t iVar = 0; iVar < nVar; ++iVar) {
-      viscFlux(iVar) *= area;
       flux(iVar) -= viscFlux(iVar);
     }
 
@@ -0,0 +1,461 @@
+/*!
+ * \file scalar_fluxes.hpp
+ * \brief Upwind convection + average gradient diffusion of scalar transport equations.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../variables/CEulerVariable.hpp"
+#include "../../variables/CIncEulerVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Reconstruction of scalars, optionally with a point-based limiter.
+ * \note Equivalent to musclUnlimited and musclPointLimited, but it also works for a single scalar.
+ */
+template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclScalars(Int iPoint,
+                              const VectorDbl<nDim>& vector_ij,
+                              Double scale,
+                              bool limiter,
+                              const Limiter_t& limiters,
+                              const Gradient_t& gradient,
+                              VectorDbl<nVar>& vars) {
+  const auto grad = gatherFlatVariables<nVar,nDim>(iPoint, gradient);
+  VectorDbl<nVar> lim;
+  if (limiter) lim = gatherVariables<nVar>(iPoint, limiters);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    const Double proj = scale * dot(&grad(iVar*nDim), vector_ij);
+    vars(iVar) += limiter ? lim(iVar) * proj : proj;
+  }
+}
+
+/*!
+ * \class CScalarFluxBase
+ * \ingroup ConvDiscr
+ * \brief Base class for the edge fluxes of scalar transport equations, it computes
+ * the scalar upwind convective flux (see CUpwScalar) and the projected (corrected)
+ * average gradient (see CAvgGrad_Scalar). Derived classes implement the model-specific
+ * diffusive flux in a const "diffusiveFlux" method.
+ * \note The flow primitives are fetched from the flow solver variables given at construction.
+ */
+template<class Derived, class FlowIndices, size_t NDIM, size_t NVAR>
+class CScalarFluxBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  /*--- Enough to access the eddy viscosity of compressible and incompressible solvers. ---*/
+  static constexpr size_t nPrimVar = nDim+7;
+  /*--- Velocity and density, the only flow variables used by the convective flux. ---*/
+  static constexpr size_t nPrimVarRecon = nDim+3;
+
+  const FlowIndices idx;
+  const bool dynamicGrid;
+  const bool limiterFlow;
+  const CVariable* flowVars;
+
+  /*!
+   * \brief Constructor, store some constants.
+   */
+  CScalarFluxBase(const CConfig& config, const CVariable* flowVars_) :
+    idx(nDim, config.GetnSpecies()),
+    dynamicGrid(config.GetDynamic_Grid()),
+    /*--- Edge-based flow limiters would need to be recomputed, see CScalarSolver::Upwind_Residual. ---*/
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE)),
+    flowVars(flowVars_) {
+    static_assert(nPrimVarRecon > nDim+2, "Density is not reconstructed.");
+    assert(idx.Density() < nPrimVarRecon && idx.EddyViscosity() < nPrimVar);
+  }
+
+  /*!
+   * \brief Diagonal entry of a Jacobian, the Jacobians of all scalar models are diagonal.
+   * \note Works for 1x1 matrices, which are accessed as vectors.
+   */
+  FORCEINLINE static Double& diag(MatrixDbl<nVar>& jac, size_t iVar) { return jac.data()[iVar*(nVar+1)]; }
+
+public:
+  /*!
+   * \brief Implementation of the scalar convective and diffusive fluxes.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    /*--- These options are set per solver in CConfig's GlobalParams, they cannot be stored. ---*/
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+    const bool musclFlow = config.GetMUSCL_Flow() && muscl &&
+                           (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow primitives and scalars w/o reconstruction. ---*/
+
+    CPair<VectorDbl<nPrimVar> > V;
+    V.i = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V.j = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    CPair<VectorDbl<nVar> > U;
+    U.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    U.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstructed flow primitives and scalars for the convective flux. ---*/
+
+    CPair<VectorDbl<nPrimVarRecon> > Vr;
+    for (size_t iVar = 0; iVar < nPrimVarRecon; ++iVar) {
+      Vr.i(iVar) = V.i(iVar);
+      Vr.j(iVar) = V.j(iVar);
+    }
+    CPair<VectorDbl<nVar> > Ur = U;
+
+    if (musclFlow) {
+      const auto& gradients = flowVars->GetGradient_Reconstruction();
+      if (limiterFlow) {
+        const auto& limiters = flowVars->GetLimiter_Primitive();
+        musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, Vr.i);
+        musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, Vr.j);
+      } else {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, Vr.i);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, Vr.j);
+      }
+    }
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      const auto& limiters = solution.GetLimiter();
+      musclScalars(iPoint, vector_ij, 0.5, limiter, limiters, gradients, Ur.i);
+      musclScalars(jPoint, vector_ij,-0.5, limiter, limiters, gradients, Ur.j);
+    }
+
+    /*--- Upwind convective flux. ---*/
+
+    Double q_ij = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      q_ij += 0.5 * (Vr.i(idx.Velocity()+iDim) + Vr.j(idx.Velocity()+iDim)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      q_ij -= 0.5 * (dot(gatherVariables<nDim>(iPoint, gridVel), normal) +
+                     dot(gatherVariables<nDim>(jPoint, gridVel), normal));
+    }
+    const Double a0 = fmax(0.0, q_ij);
+    const Double a1 = fmin(0.0, q_ij);
+
+    /*--- Conservative models transport rho*phi, the Jacobians are w.r.t. rho*phi. ---*/
+    const Double w_i = Derived::Conservative ? Vr.i(idx.Density()) : Double(1.0);
+    const Double w_j = Derived::Conservative ? Vr.j(idx.Density()) : Double(1.0);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * w_i * Ur.i(iVar) + a1 * w_j * Ur.j(iVar);
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      for (size_t i = 0; i < nVar*nVar; ++i) {
+        jac_i.data()[i] = 0.0;
+        jac_j.data()[i] = 0.0;
+      }
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diag(jac_i, iVar) = a0;
+        diag(jac_j, iVar) = a1;
+      }
+    }
+
+    /*--- Projected average gradient, corrected with the directional derivative. ---*/
+
+    const Double dist2_ij = squaredNorm(vector_ij);
+    const Double proj_vector_ij = dot(vector_ij, normal) / fmax(dist2_ij, EPS);
+
+    auto avgGrad = gatherFlatVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherFlatVariables<nVar,nDim>(jPoint, solution.GetGradient());
+    for (size_t i = 0; i < nVar*nDim; ++i) {
+      avgGrad(i) = 0.5 * (avgGrad(i) + grad_j(i));
+    }
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double* grad = &avgGrad(iVar*nDim);
+      const Double edgeProj = dot(grad, vector_ij) - (U.j(iVar) - U.i(iVar));
+      projGrad(iVar) = dot(grad, normal) - edgeProj * proj_vector_ij;
+    }
+
+    /*--- Model-specific diffusive flux (static polymorphism), it is subtracted from the flux. ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    derived->diffusiveFlux(iPoint, jPoint, V, U, projGrad, proj_vector_ij,
+                           solution, config, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CTurbSAFlux
+ * \ingroup ConvDiscr
+ * \brief Fluxes of the Spalart-Allmaras model (see CUpwSca_TurbSA, CAvgGrad_TurbSA, and CAvgGrad_TurbSA_Neg).
+ */
+template<class FlowIndices, size_t NDIM, bool Negative>
+class CTurbSAFlux : public CScalarFluxBase<CTurbSAFlux<FlowIndices,NDIM,Negative>,FlowIndices,NDIM,1> {
+private:
+  using Base = CScalarFluxBase<CTurbSAFlux<FlowIndices,NDIM,Negative>,FlowIndices,NDIM,1>;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::idx;
+  using Base::diag;
+
+public:
+  static constexpr bool Conservative = false;
+
+  /*!
+   * \brief Constructor, forward to base.
+   */
+  template<class... Ts>
+  CTurbSAFlux(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Updates flux and Jacobians with the diffusion of nu tilde.
+   */
+  FORCEINLINE void diffusiveFlux(Int, Int,
+                                 const CPair<VectorDbl<nPrimVar> >& V,
+                                 const CPair<VectorDbl<nVar> >& U,
+                                 const VectorDbl<nVar>& projGrad,
+                                 Double proj_vector_ij,
+                                 const CVariable&,
+                                 const CConfig&,
+                                 bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+    constexpr passivedouble sigma = 2.0/3.0;
+    constexpr passivedouble cn1 = 16.0;
+
+    /*--- Mean effective viscosity. ---*/
+
+    const Double nu_i = V.i(idx.LaminarViscosity()) / V.i(idx.Density());
+    const Double nu_j = V.j(idx.LaminarViscosity()) / V.j(idx.Density());
+    const Double nu_ij = 0.5 * (nu_i + nu_j);
+    const Double nu_tilde_ij = 0.5 * (U.i(0) + U.j(0));
+
+    Double nu_e = nu_ij + nu_tilde_ij;
+    if (Negative) {
+      /*--- fn is 1 for positive nu tilde, clipping Xi avoids the singularity of fn. ---*/
+      const Double Xi = fmin(nu_tilde_ij / nu_ij, 0.0);
+      const Double fn = (cn1 + Xi*Xi*Xi) / (cn1 - Xi*Xi*Xi);
+      nu_e = nu_ij + fn * nu_tilde_ij;
+    }
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    /*--- For Jacobians -> Use of TSL approx. to compute derivatives of the gradients. ---*/
+
+    if (implicit) {
+      diag(jac_i,0) -= (0.5*projGrad(0) - nu_e*proj_vector_ij) / sigma;
+      diag(jac_j,0) -= (0.5*projGrad(0) + nu_e*proj_vector_ij) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CTurbSSTFlux
+ * \ingroup ConvDiscr
+ * \brief Fluxes of the Menter SST model (see CUpwSca_TurbSST and CAvgGrad_TurbSST).
+ */
+template<class FlowIndices, size_t NDIM>
+class CTurbSSTFlux : public CScalarFluxBase<CTurbSSTFlux<FlowIndices,NDIM>,FlowIndices,NDIM,2> {
+private:
+  using Base = CScalarFluxBase<CTurbSSTFlux<FlowIndices,NDIM>,FlowIndices,NDIM,2>;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::idx;
+  using Base::diag;
+
+  const su2double sigma_k1;
+  const su2double sigma_k2;
+  const su2double sigma_om1;
+  const su2double sigma_om2;
+
+public:
+  static constexpr bool Conservative = true;
+
+  /*!
+   * \brief Constructor, store the model constants and forward to base.
+   */
+  CTurbSSTFlux(const CConfig& config, const CVariable* flowVars, const su2double* constants) :
+    Base(config, flowVars),
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with the diffusion of k and omega.
+   */
+  FORCEINLINE void diffusiveFlux(Int iPoint, Int jPoint,
+                                 const CPair<VectorDbl<nPrimVar> >& V,
+                                 const CPair<VectorDbl<nVar> >&,
+                                 const VectorDbl<nVar>& projGrad,
+                                 Double proj_vector_ij,
+                                 const CVariable& solution,
+                                 const CConfig&,
+                                 bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+    /*--- Blended constants for the viscous terms. ---*/
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    const Double sigma_kine_i = F1_i*sigma_k1 + (1.0 - F1_i)*sigma_k2;
+    const Double sigma_kine_j = F1_j*sigma_k1 + (1.0 - F1_j)*sigma_k2;
+    const Double sigma_omega_i = F1_i*sigma_om1 + (1.0 - F1_i)*sigma_om2;
+    const Double sigma_omega_j = F1_j*sigma_om1 + (1.0 - F1_j)*sigma_om2;
+
+    /*--- Mean effective dynamic viscosity. ---*/
+
+    const Double mu_i = V.i(idx.LaminarViscosity()), mut_i = V.i(idx.EddyViscosity());
+    const Double mu_j = V.j(idx.LaminarViscosity()), mut_j = V.j(idx.EddyViscosity());
+
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (mu_i + sigma_kine_i*mut_i + mu_j + sigma_kine_j*mut_j);
+    diff(1) = 0.5 * (mu_i + sigma_omega_i*mut_i + mu_j + sigma_omega_j*mut_j);
+
+    /*--- For Jacobians -> Use of TSL approx. to compute derivatives of the gradients. ---*/
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i(idx.Density());
+    const Double proj_on_rho_j = proj_vector_ij / V.j(idx.Density());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+      if (implicit) {
+        diag(jac_i,iVar) += diff(iVar) * proj_on_rho_i;
+        diag(jac_j,iVar) -= diff(iVar) * proj_on_rho_j;
+      }
+    }
+  }
+};
+
+/*!
+ * \class CSpeciesFlux
+ * \ingroup ConvDiscr
+ * \brief Fluxes of the species transport equations (see CUpwSca_Species and CAvgGrad_Species).
+ */
+template<class FlowIndices, size_t NDIM, size_t NVAR>
+class CSpeciesFlux : public CScalarFluxBase<CSpeciesFlux<FlowIndices,NDIM,NVAR>,FlowIndices,NDIM,NVAR> {
+private:
+  using Base = CScalarFluxBase<CSpeciesFlux<FlowIndices,NDIM,NVAR>,FlowIndices,NDIM,NVAR>;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::idx;
+  using Base::diag;
+
+  const bool turbulence;
+  const su2double schmidtTurb;
+
+public:
+  static constexpr bool Conservative = true;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSpeciesFlux(const CConfig& config, Ts&... args) : Base(config, args...),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    schmidtTurb(config.GetSchmidt_Number_Turbulent()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with the mass diffusion of the species.
+   */
+  FORCEINLINE void diffusiveFlux(Int iPoint, Int jPoint,
+                                 const CPair<VectorDbl<nPrimVar> >& V,
+                                 const CPair<VectorDbl<nVar> >&,
+                                 const VectorDbl<nVar>& projGrad,
+                                 Double proj_vector_ij,
+                                 const CVariable& solution,
+                                 const CConfig&,
+                                 bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+    const auto diff_i = gatherVariables<nVar>(iPoint, diffusivity);
+    const auto diff_j = gatherVariables<nVar>(jPoint, diffusivity);
+
+    const Double rho_i = V.i(idx.Density());
+    const Double rho_j = V.j(idx.Density());
+
+    Double diffTurb = 0.0;
+    if (turbulence) {
+      diffTurb = 0.5 * (V.i(idx.EddyViscosity()) + V.j(idx.EddyViscosity())) / schmidtTurb;
+    }
+
+    /*--- Use TSL approx. to compute derivatives of the gradients, off-diagonal entries are zero. ---*/
+
+    const Double proj_on_rho_i = proj_vector_ij / rho_i;
+    const Double proj_on_rho_j = proj_vector_ij / rho_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diff = 0.5 * (rho_i * diff_i(iVar) + rho_j * diff_j(iVar)) + diffTurb;
+      flux(iVar) -= diff * projGrad(iVar);
+      if (implicit) {
+        diag(jac_i,iVar) += diff * proj_on_rho_i;
+        diag(jac_j,iVar) -= diff * proj_on_rho_j;
+      }
+    }
+  }
+};
@@ -157,6 +157,15 @@ template<size_t nRows, size_t nCols, class Container>
 FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
   return vars.template get<MatrixDbl<nRows,nCols> >(iPoint);
 }
+
+/*!
+ * \brief Gather a matrix of variables from outer index iPoint of a 3D container, as a
+ * row-major vector (unlike MatrixDbl this can be used for single row matrices).
+ */
+template<size_t nRows, size_t nCols, class Container>
+FORCEINLINE VectorDbl<nRows*nCols> gatherFlatVariables(Int iPoint, const Container& vars) {
+  return vars.template get<VectorDbl<nRows*nCols> >(iPoint);
+}
 #else
 
 namespace {
@@ -203,6 +212,20 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
   }
   return x;
 }
+
+template<size_t nRows, size_t nCols, class Container>
+FORCEINLINE VectorDbl<nRows*nCols> gatherFlatVariables(Int iPoint, const Container& vars) {
+  VectorDbl<nRows*nCols> x;
+  for (size_t i=0; i<nRows; ++i) {
+    for (size_t j=0; j<nCols; ++j) {
+      for (size_t k=0; k<Double::Size; ++k) {
+        AD::SetPreaccIn(vars(iPoint[k],i,j));
+        x(i*nCols+j)[k] = vars(iPoint[k],i,j);
+      }
+    }
+  }
+  return x;
+}
 #endif
 
 /*!
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <cmath>
 #include <map>
+#include <set>
 #include <sstream>
 #include <iomanip>
 #include <limits>
@@ -53,6 +54,7 @@ inline su2double hypot(const su2double& a, const su2double& b) {
 class CGeometry;
 class CSolver;
 class CFileWriter;
+class CAsyncFileWriter;
 class CParallelDataSorter;
 class CConfig;
 
@@ -243,6 +245,8 @@ protected:
 
   CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
   CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
+  CParallelDataSorter* extractDataSorter;   //!< Data sorter of the extracted part of the volume (EXTRACT_KIND)
+  CAsyncFileWriter* asyncWriter = nullptr;  //!< Writes files in the background (OUTPUT_ASYNC)
 
   vector<string> volumeFieldNames;     //!< Vector containing the volume field names
   unsigned short nVolumeFields;        //!< Number of fields in the volume output
@@ -594,6 +598,20 @@ public:
    */
   bool GetCauchyCorrectedTimeConvergence(const CConfig *config);
 
+  /*!
+   * \brief Get the number of mantissa bits dropped for each volume field when writing compressed restart files.
+   * \param[in] config - Definition of the particular problem.
+   * \return Dropped bits in the order of the volume fields (all 0 unless RESTART_COMPRESSION= LOSSY).
+   */
+  vector<int> GetRestartDroppedBits(const CConfig *config) const;
+
+  /*!
+   * \brief Check if a volume field is read back by the solvers on restart, these are never compressed lossily.
+   * \param[in] name - Name of the field.
+   * \param[in] group - Output group of the field.
+   */
+  static bool IsRestartField(const string& name, const string& group);
+
   /*!
    * \brief Allocates the appropriate file writer based on the chosen format and writes sorted data to file.
    * \param[in] config - Definition of the particular problem.
@@ -850,6 +868,13 @@ protected:
    */
   void AllocateDataSorters(CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Re-create the data sorter of the extracted part of the volume with the current data (FVM only).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void AllocateExtractDataSorter(CConfig *config, CGeometry *geometry);
+
   /*!
    * \brief Computes the custom and combo objectives.
    * \note To be called after all other history outputs are set.
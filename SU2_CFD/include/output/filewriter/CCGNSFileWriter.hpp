@@ -45,6 +45,7 @@ class CCGNSFileWriter final : public CFileWriter {
   int cgnsBase;   /*!< \brief CGNS database index. */
   int cgnsZone;   /*!< \brief CGNS zone index. */
   int cgnsFields; /*!< \brief CGNS flow solution index. */
+  int cgnsSection; /*!< \brief CGNS index of the current element section. */
 
   int nZones;    /*!< \brief Total number of zones in the CGNS file. */
   int nSections; /*!< \brief Total number of sections in the CGNS file. */
@@ -109,6 +110,25 @@ class CCGNSFileWriter final : public CFileWriter {
    */
   void InitializeFields();
 
+  /*!
+   * \brief Write a block of a coordinate or field (master only), the operation may be deferred.
+   * \param[in] isCoord - True if the field is a coordinate.
+   * \param[in] FieldName - Field name in the CGNS.
+   * \param[in] nodeBegin - First node of the block (1-based).
+   * \param[in] nodeEnd - Last node of the block (inclusive).
+   * \param[in,out] buffer - Values of the block, moved into the operation.
+   */
+  void WriteFieldBlock(bool isCoord, const string& FieldName, cgsize_t nodeBegin, cgsize_t nodeEnd,
+                       vector<dataPrecision>& buffer);
+
+  /*!
+   * \brief Write a block of the connectivity of the current section (master only), the operation may be deferred.
+   * \param[in] firstElem - First element of the block (1-based).
+   * \param[in] endElem - Last element of the block (inclusive).
+   * \param[in,out] buffer - Connectivity of the block, moved into the operation.
+   */
+  void WriteConnectivityBlock(cgsize_t firstElem, cgsize_t endElem, vector<cgsize_t>& buffer);
+
   /*!
    * \brief Call a generic CGNS function.
    * \param[in] ier - error value.
@@ -0,0 +1,90 @@
+/*!
+ * \file CExtractFVMDataSorter.hpp
+ * \brief Headers fo the data sorter class for the extracted part of the FVM volume output.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFVMDataSorter.hpp"
+#include <functional>
+#include <vector>
+
+/*!
+ * \brief Data sorter for a subset of the elements and fields of the FVM volume output (see EXTRACT_KIND).
+ * \details The elements are selected on the partitioned data, and only the points of those elements
+ * are renumbered, communicated, and written. The unsorted data is taken from the volume data sorter,
+ * hence the volume output must be loaded (but not sorted) before calling ::SortOutputData.
+ */
+class CExtractFVMDataSorter final: public CParallelDataSorter{
+
+private:
+
+  const CFVMDataSorter* volumeSorter;     //!< Volume data sorter that holds the unsorted data
+  vector<unsigned short> volumeFields;    //!< Index of each output field in the volume data sorter
+  vector<unsigned long> extractedPoints;  //!< Local (domain) index of the points written by this rank
+
+public:
+
+  /*!
+   * \brief Constructor
+   * \param[in] config - Pointer to the current config structure
+   * \param[in] geometry - Pointer to the current geometry
+   * \param[in] valVolumeSorter - Volume data sorter that holds the unsorted data
+   * \param[in] valFieldNames - Vector containing the field names, the coordinates must come first
+   * \param[in] valVolumeFields - Index of each field in the volume data sorter
+   * \param[in] isoField - Index of the iso-surface field in the volume data sorter (for EXTRACT_KIND= ISOSURFACE)
+   */
+  CExtractFVMDataSorter(CConfig *config, CGeometry *geometry, const CFVMDataSorter* valVolumeSorter,
+                        const vector<string> &valFieldNames, const vector<unsigned short> &valVolumeFields,
+                        int isoField);
+
+  /*!
+   * \brief Copy the extracted fields from the volume data sorter and sort them into a linear partitioning.
+   */
+  void SortOutputData() override;
+
+  /*!
+   * \brief Get the global index of a point.
+   * \input iPoint - the point ID.
+   * \return Global index of a specific point.
+   */
+  unsigned long GetGlobalIndex(unsigned long iPoint) const override {
+    return linearPartitioner.GetFirstIndexOnRank(rank) + iPoint;
+  }
+
+private:
+
+  /*!
+   * \brief Send global point indices to the ranks that own them in a linear partitioning and
+   * (optionally) return one value per index computed by the owner.
+   * \param[in] globalIDs - Global indices of the points.
+   * \param[in] partitioner - Linear partitioning of the global indices.
+   * \param[in] owner - Function called by the owning rank with the index relative to its first index.
+   * \param[in] reply - Whether the values returned by "owner" are sent back.
+   * \return The value for each index in "globalIDs" (empty if "reply" is false).
+   */
+  vector<unsigned long> QueryOwners(const vector<unsigned long>& globalIDs, const CLinearPartitioner& partitioner,
+                                    const std::function<unsigned long(unsigned long)>& owner, bool reply) const;
+
+};
@@ -33,6 +33,7 @@
 #include <string>
 #include <cstring>
 #include <fstream>
+#include <functional>
 
 #include "../../output/filewriter/CParallelDataSorter.hpp"
 
@@ -96,6 +97,28 @@ protected:
   FILE* fhw;
 #endif
 
+  /*!
+   * \brief The communicator used to open and close files.
+   */
+  SU2_MPI::Comm ioComm;
+
+  /*!
+   * \brief If true, the file operations are recorded (with a copy of the data) instead of executed.
+   */
+  bool deferredIO = false;
+
+  /*!
+   * \brief The recorded file operations, executed by FlushDeferredIO.
+   */
+  vector<function<void()> > deferredOps;
+
+  /*!
+   * \brief Execute an operation that accesses the file, or record it if the file operations are deferred.
+   * \note The operation must not reference data that may change before it is executed.
+   * \param[in] op - The operation.
+   */
+  void RunOrDefer(function<void()> op);
+
 public:
   /*!
    * \brief Construct a file writer using field names, the data sorter and the file extension.
@@ -121,6 +144,19 @@ public:
    */
   virtual void WriteData(string val_filename){}
 
+  /*!
+   * \brief Record the file operations of subsequent calls to WriteData instead of executing them.
+   * \note This allows writing the file from a background thread (see CAsyncFileWriter). Only the file
+   *       operations are deferred, all other communication takes place in WriteData.
+   * \param[in] comm - Communicator for the file operations, it must not be used by other threads.
+   */
+  void SetDeferredIO(SU2_MPI::Comm comm);
+
+  /*!
+   * \brief Execute the recorded file operations.
+   */
+  void FlushDeferredIO();
+
   /*!
    * \brief Get the bandwith used for the last writing
    */
@@ -0,0 +1,70 @@
+/*!
+ * \file CSU2CompressedFileWriter.hpp
+ * \brief Headers for the compressed SU2 binary (restart) file writer class.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2CompressedFileWriter
+ * \brief Writes the SU2 binary restart format with the data compressed in blocks of points.
+ * \note The file starts like the uncompressed format (5 ints, with a different magic number, and the field names),
+ *       followed by the dropped bits of each field and a table of the first point and byte offset of each block.
+ *       Each rank compresses its own points, and the blocks can be read independently (see CSolver).
+ */
+class CSU2CompressedFileWriter final: public CFileWriter{
+
+  /*!
+   * \brief Number of low bits dropped for each field (0 for lossless), see CompressionToolbox::DroppedBits.
+   */
+  vector<int> droppedBits;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Maximum number of points in a compressed block.
+   */
+  static constexpr unsigned long blockSize = 2048;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valDroppedBits - Number of low bits dropped for each field of the data sorter.
+   */
+  CSU2CompressedFileWriter(CParallelDataSorter* valDataSorter, vector<int> valDroppedBits);
+
+  /*!
+   * \brief Write sorted data to file in compressed SU2 binary file format
+   * \param[in] val_filename - The filename to write
+   */
+  void WriteData(string val_filename) override ;
+
+};
@@ -0,0 +1,96 @@
+/*!
+ * \file CAsyncFileWriter.hpp
+ * \brief Header file for the background writing of output files.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "../../../../Common/include/parallelization/mpi_structure.hpp"
+
+class CFileWriter;
+
+/*!
+ * \class CAsyncFileWriter
+ * \brief Writes output files in a background thread while the solver continues.
+ * \note The file writers record their file operations together with a copy of the data (see
+ *       CFileWriter::SetDeferredIO), the thread then executes them in order using a duplicate of
+ *       the communicator. All ranks queue the same files in the same order, which keeps the
+ *       collective MPI I/O consistent. With MPI this requires MPI_THREAD_MULTIPLE.
+ * \ingroup Output
+ */
+class CAsyncFileWriter {
+ private:
+  SU2_MPI::Comm comm;                 /*!< \brief Communicator reserved for the background file operations. */
+  std::thread worker;                 /*!< \brief Thread that executes the file operations. */
+  std::mutex mtx;                     /*!< \brief Protects the queue. */
+  std::condition_variable cv;         /*!< \brief Signals new work, and completed work. */
+  std::deque<CFileWriter*> queue;     /*!< \brief Writers waiting to be flushed, the front one may be in progress. */
+  bool stop = false;                  /*!< \brief Tells the worker to finish. */
+
+  /*!
+   * \brief Main loop of the background thread.
+   */
+  void Work();
+
+ public:
+  /*!
+   * \brief Duplicate the communicator and start the background thread (collective).
+   */
+  CAsyncFileWriter();
+
+  /*!
+   * \brief Wait for all pending files, stop the thread, and free the communicator (collective).
+   */
+  ~CAsyncFileWriter();
+
+  CAsyncFileWriter(const CAsyncFileWriter&) = delete;
+  CAsyncFileWriter& operator=(const CAsyncFileWriter&) = delete;
+
+  /*!
+   * \brief Check whether files can be written in the background, i.e. if the MPI library is thread safe.
+   */
+  static bool IsSupported();
+
+  /*!
+   * \brief Prepare a file writer to record its operations, must be called before WriteData.
+   * \param[in] writer - The file writer.
+   */
+  void Prepare(CFileWriter* writer) const;
+
+  /*!
+   * \brief Queue a file writer whose operations have been recorded, the writer is deleted once flushed.
+   * \param[in] writer - The file writer.
+   */
+  void Push(CFileWriter* writer);
+
+  /*!
+   * \brief Block until all queued files have been written.
+   */
+  void Wait();
+};
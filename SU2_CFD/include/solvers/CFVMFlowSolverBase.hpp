@@ -938,7 +938,10 @@ class CFVMFlowSolverBase : public CSolver {
       END_SU2_OMP_FOR
     }
 
-    /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+    /*--- Right hand side of the system (-Residual) and initial guess (x = 0).
+     * Each point only reads its own values, the reverse path needs no atomic updates. ---*/
+
+    AD::StartNoSharedReading();
 
     SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
     for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -965,6 +968,8 @@ class CFVMFlowSolverBase : public CSolver {
     }
     END_SU2_OMP_FOR
 
+    AD::EndNoSharedReading();
+
     /*--- "Add" residuals from all threads to global residual variables. ---*/
     ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
@@ -982,6 +987,7 @@ class CFVMFlowSolverBase : public CSolver {
     /*--- Update solution with under-relaxation and communicate it. ---*/
 
     if (!config->GetContinuous_Adjoint()) {
+      AD::StartNoSharedReading();
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -989,6 +995,7 @@ class CFVMFlowSolverBase : public CSolver {
         }
       }
       END_SU2_OMP_FOR
+      AD::EndNoSharedReading();
     }
 
     for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
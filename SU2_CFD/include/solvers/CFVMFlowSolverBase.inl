@@ -386,7 +386,9 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
+  AD::StartTapePhase(SolverName, "gradients");
   computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient);
+  AD::EndTapePhase();
 }
 
 template <class V, ENUM_REGIME R>
@@ -410,8 +412,10 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
 
+  AD::StartTapePhase(SolverName, "gradients");
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
                                primitives, 0, nPrimVarGrad, gradient, rmatrix);
+  AD::EndTapePhase();
 }
 
 template <class V, ENUM_REGIME R>
@@ -423,8 +427,10 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  AD::StartTapePhase(SolverName, "limiters");
   computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+  AD::EndTapePhase();
 }
 
 template <class V, ENUM_REGIME R>
@@ -560,6 +566,8 @@ void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* confi
 
   const su2double allowableRatio = 0.2;
 
+  AD::StartNoSharedReading();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     su2double localUnderRelaxation = 1.0;
@@ -588,6 +596,8 @@ void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* confi
     nodes->SetUnderRelaxation(iPoint, localUnderRelaxation);
   }
   END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
 }
 
 template <class V, ENUM_REGIME R>
@@ -875,7 +885,7 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
 
           /*--- Rewind the index to retrieve the Coords. ---*/
           index = counter * Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
+          const auto iCoord = index;
 
           su2double GridVel[MAXNDIM] = {0.0};
           if (!steady_restart) {
@@ -885,7 +895,7 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
           }
 
           for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Restart_Data[iCoord + iDim]);
             geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
           }
         }
@@ -896,10 +906,9 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
         if (static_fsi && update_geo) {
         /*--- Rewind the index to retrieve the Coords. ---*/
           index = counter*Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
 
           for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Restart_Data[index + iDim]);
           }
         }
 
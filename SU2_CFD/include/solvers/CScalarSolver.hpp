@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +80,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  bool edgeNumericsInstantiated = false; /*!< \brief Whether the creation of edgeNumerics was attempted. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -297,6 +302,21 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the convective and viscous edge fluxes.
+   * \note Models without a vectorized implementation leave edgeNumerics null.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous residual contributions using vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, const CConfig* config);
+
  private:
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
@@ -28,6 +28,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
@@ -85,6 +86,7 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
@@ -136,6 +138,24 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   const bool limiter = (config->GetKind_SlopeLimit() != LIMITER::NONE) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
 
+  /*--- Use vectorization if the model supports it, the SIMD numerics are created on the first call. ---*/
+  if (!edgeNumericsInstantiated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      /*--- The group size of the edge colors must be divisible by the SIMD length. ---*/
+      if (ReducerStrategy || (omp_get_max_threads() == 1) ||
+          (config->GetEdgeColoringGroupSize() % Double::Size == 0)) {
+        InstantiateEdgeNumerics(solver_container, config);
+      }
+      edgeNumericsInstantiated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  if (edgeNumerics) {
+    EdgeFluxResidual(geometry, config);
+    return;
+  }
+
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
   const bool musclFlow = config->GetMUSCL_Flow() && muscl && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
   /*--- Only consider flow limiters for cell-based limiters, edge-based would need to be recomputed. ---*/
@@ -339,6 +359,50 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   }
 }
 
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(CGeometry* geometry, const CConfig* config) {
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+  }
+}
+
 template <class VariableType>
 void CScalarSolver<VariableType>::SumEdgeFluxes(CGeometry* geometry) {
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -455,7 +519,9 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
   su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
   unsigned long idxMax[MAXNVAR] = {0};
 
-  /*--- Build implicit system ---*/
+  /*--- Build implicit system, each point only reads its own values. ---*/
+
+  AD::StartNoSharedReading();
 
   SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -483,6 +549,8 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
   }
   END_SU2_OMP_FOR
 
+  AD::EndNoSharedReading();
+
   /*--- "Add" residuals from all threads to global residual variables. ---*/
   ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 }
@@ -497,6 +565,8 @@ void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry,
   /*--- Update solution (system written in terms of increments) ---*/
 
   if (!adjoint) {
+    AD::StartNoSharedReading();
+
     /*--- Update the scalar solution. For transport equations, where Solution is not equivalent with the transported
      * quantity, multiply the respective factor.  ---*/
     if (Conservative) {
@@ -524,6 +594,8 @@ void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry,
       }
       END_SU2_OMP_FOR
     }
+
+    AD::EndNoSharedReading();
   }
 
   for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
@@ -567,6 +639,8 @@ void CScalarSolver<VariableType>::ExplicitEuler_Iteration(CGeometry* geometry, C
   su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  AD::StartNoSharedReading();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     const su2double dt = nodes->GetDelta_Time(iPoint);
@@ -581,6 +655,8 @@ void CScalarSolver<VariableType>::ExplicitEuler_Iteration(CGeometry* geometry, C
   }
   END_SU2_OMP_FOR
 
+  AD::EndNoSharedReading();
+
   /*--- "Add" residuals from all threads to global residual variables. ---*/
   ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
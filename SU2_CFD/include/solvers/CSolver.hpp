@@ -55,6 +55,7 @@
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
 #include "../../../Common/include/graph_coloring_structure.hpp"
 #include "../../../Common/include/toolboxes/MMS/CVerificationSolution.hpp"
+#include "../../../Common/include/toolboxes/CRestartData.hpp"
 #include "../variables/CVariable.hpp"
 
 #ifdef HAVE_LIBROM
@@ -135,7 +136,7 @@ protected:
 
   vector<int> Restart_Vars;            /*!< \brief Auxiliary structure for holding the number of variables and points in a restart. */
   int Restart_ExtIter;                 /*!< \brief Auxiliary structure for holding the external iteration offset from a restart. */
-  vector<passivedouble> Restart_Data;  /*!< \brief Auxiliary structure for holding the data values from a restart. */
+  CRestartData Restart_Data;           /*!< \brief Auxiliary structure for holding the data values from a restart. */
   unsigned short nOutputVariables;     /*!< \brief Number of variables to write. */
 
   unsigned long nMarker;            /*!< \brief Total number of markers using the grid information. */
@@ -3393,6 +3394,30 @@ public:
                                const CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read a compressed native SU2 restart file (see CSU2CompressedFileWriter).
+   * \note Called by Read_SU2_Restart_Binary, each rank reads and decompresses only the blocks that contain its points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file (with extension).
+   */
+  void Read_SU2_Restart_Compressed(CGeometry *geometry,
+                                   const CConfig *config,
+                                   const string& val_filename);
+
+  /*!
+   * \brief Map a native SU2 binary restart file into memory and use the values of the local points in place.
+   * \note Called by Read_SU2_Restart_Binary (RESTART_MMAP= YES), does nothing if the file cannot be mapped
+   *       or if the restart needs to be interpolated.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file (with extension).
+   * \return True if the restart data was mapped.
+   */
+  bool Read_SU2_Restart_Mapped(CGeometry *geometry,
+                               const CConfig *config,
+                               const string& val_filename);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
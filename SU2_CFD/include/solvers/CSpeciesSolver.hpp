@@ -92,6 +92,13 @@ class CSpeciesSolver : public CScalarSolver<CSpeciesVariable> {
   void Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container, CNumerics* numerics,
                         CConfig* config) final;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the convective and viscous edge fluxes.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) override;
+
   /*!
    * \brief Impose the inlet boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
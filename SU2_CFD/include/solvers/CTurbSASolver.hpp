@@ -128,6 +128,13 @@ public:
   void Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                         CNumerics* numerics, CConfig* config) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the convective and viscous edge fluxes.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) override;
+
   /*!
    * \brief Source term computation.
    * \param[in] geometry - Geometrical definition of the problem.
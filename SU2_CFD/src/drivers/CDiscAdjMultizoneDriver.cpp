@@ -447,6 +447,8 @@ void CDiscAdjMultizoneDriver::Run() {
 
     AD::ClearAdjoints();
 
+    if (StopCalc && driver_config->GetWrt_AD_Statistics()) AD::PrintEvaluationTimes();
+
     /*--- Compute the geometrical sensitivities and write them to file, except for time_domain. ---*/
 
     if (time_domain) continue;
@@ -569,6 +571,7 @@ void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long Iter, bool for
 void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape tape_type, unsigned short record_zone) {
 
   AD::Reset();
+  AD::ResetTapePhases(kind_recording != RECORDING::CLEAR_INDICES && driver_config->GetWrt_AD_Statistics());
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -683,6 +686,7 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
       }
     }
 #endif
+    AD::PrintTapePhases();
   }
 
   AD::StopRecording();
@@ -807,6 +811,7 @@ void CDiscAdjMultizoneDriver::ComputeAdjoints(unsigned short iZone, bool eval_tr
   const unsigned short enter_izone = iZone*2+1 + ITERATION_READY;
   const unsigned short leave_izone = iZone*2 + ITERATION_READY;
 
+  AD::StartEvaluationTimer();
   AD::ComputeAdjoint(enter_izone, leave_izone);
 
   /*--- Compute adjoints of transfer and mesh deformation routines, only strictly needed
@@ -820,6 +825,7 @@ void CDiscAdjMultizoneDriver::ComputeAdjoints(unsigned short iZone, bool eval_tr
    *    are extracted (e.g. AoA, Mach, etc.) ---*/
 
   AD::ComputeAdjoint(DEPENDENCIES, START);
+  AD::StopEvaluationTimer();
 
 }
 
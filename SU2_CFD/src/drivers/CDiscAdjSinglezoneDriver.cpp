@@ -118,6 +118,29 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- For the checkpointed unsteady adjoint the direct solutions are computed by this driver and
+   *    set by the adjoint iteration when it would otherwise load restart files. ---*/
+
+  if (config->GetnUnst_AdjointCheckpoints() > 0) {
+    directSchedule.reset(new CBinomialCheckpointing(config->GetnUnst_AdjointCheckpoints()));
+
+    iteration->SetDirectSolutionLoader([this](int directIter) {
+      const auto it = directSolutions.find(directIter);
+      if (it == directSolutions.end())
+        SU2_MPI::Error("The direct solution of time iteration " + to_string(directIter) + " was not computed.",
+                       CURRENT_FUNCTION);
+      SetAllSolutions(ZONE_0, false, it->second);
+    });
+
+    if (rank == MASTER_NODE) {
+      const bool secondOrder = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+      const auto bytes = (1.0 + secondOrder) * geometry->GetGlobal_nPoint() *
+                         GetTotalNumberOfVariables(ZONE_0, false) * sizeof(passivedouble);
+      cout << "Unsteady adjoint: " << config->GetnUnst_AdjointCheckpoints() << " checkpoints of the direct solution, "
+           << bytes / (1024.0 * 1024.0) << " MB each." << endl;
+    }
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver() {
@@ -135,6 +158,8 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
   this->TimeIter = TimeIter;
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
+  if (directSchedule) PrepareDirectSolutions();
+
   /*--- Preprocess the adjoint iteration ---*/
 
   iteration->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
@@ -153,8 +178,27 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CDiscAdjSinglezoneDriver::Run() {
 
+  /*--- FGMRES (steady problems) or quasi-Newton acceleration of the adjoint iterations. ---*/
+
+  const bool krylov = config->GetNewtonKrylov() && !config->GetTime_Domain() &&
+                      config->GetnQuasiNewtonSamples() >= KrylovMinIters;
+  if (krylov) {
+    const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+    const auto nPointDomain = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain();
+    const auto nVar = GetTotalNumberOfVariables(ZONE_0, true);
+
+    AdjRHS.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    AdjSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    AdjStart.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    LinSolver.SetToleranceType(LinearToleranceType::RELATIVE);
+
+    /*--- The correction always starts from zero, this avoids a tape evaluation for the initial residual,
+     *    which would not be counted as an adjoint iteration. ---*/
+    LinSolver.SetxIsZero(true);
+  }
+
   CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
-  if (config->GetnQuasiNewtonSamples() > 1) {
+  if (!krylov && config->GetnQuasiNewtonSamples() > 1) {
     fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
                           geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(),
                           GetTotalNumberOfVariables(ZONE_0,true),
@@ -165,26 +209,13 @@ void CDiscAdjSinglezoneDriver::Run() {
 
   for (auto Adjoint_Iter = 0ul; Adjoint_Iter < nAdjoint_Iter; Adjoint_Iter++) {
 
-    /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
-     *--- of the previous iteration. The values are passed to the AD tool.
-     *--- Issues with iteration number should be dealt with once the output structure is in place. ---*/
+    /*--- One adjoint iteration, starting from the adjoint solution of the previous one. ---*/
 
     config->SetInnerIter(Adjoint_Iter);
 
-    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
-
-    /*--- Initialize the adjoint of the objective function with 1.0. ---*/
-
-    SetAdjObjFunction();
-
-    /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
+    if (krylov) GetAllSolutions(ZONE_0, true, AdjStart);
 
-    AD::ComputeAdjoint();
-
-    /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
-
-    iteration->IterateDiscAdj(geometry_container, solver_container,
-                              config_container, ZONE_0, INST_0, false);
+    EvaluateAdjoint(true);
 
     /*--- Monitor the pseudo-time ---*/
 
@@ -192,10 +223,6 @@ void CDiscAdjSinglezoneDriver::Run() {
                                   solver_container, numerics_container, config_container,
                                   surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
 
-    /*--- Clear the stored adjoint information to be ready for a new evaluation. ---*/
-
-    AD::ClearAdjoints();
-
     /*--- Output files for steady state simulations. ---*/
 
     if (!config->GetTime_Domain()) {
@@ -212,8 +239,69 @@ void CDiscAdjSinglezoneDriver::Run() {
       SetAllSolutions(ZONE_0, true, fixPtCorrector.compute());
     }
 
+    /*--- Or with FGMRES, the tape evaluations it uses count as adjoint iterations. ---*/
+
+    if (krylov && nAdjoint_Iter - Adjoint_Iter > KrylovMinIters) {
+      const auto maxIter = min(nAdjoint_Iter - Adjoint_Iter - 2, config->GetnQuasiNewtonSamples() - 2ul);
+      Adjoint_Iter += KrylovCorrection(maxIter);
+    }
+
   }
 
+  if (config->GetWrt_AD_Statistics()) AD::PrintEvaluationTimes();
+
+}
+
+void CDiscAdjSinglezoneDriver::EvaluateAdjoint(bool seedObjective) {
+
+  /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
+   *--- of the previous iteration. The values are passed to the AD tool.
+   *--- Issues with iteration number should be dealt with once the output structure is in place. ---*/
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  /*--- Initialize the adjoint of the objective function with 1.0. ---*/
+
+  if (seedObjective) SetAdjObjFunction();
+
+  /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
+
+  AD::StartEvaluationTimer();
+  AD::ComputeAdjoint();
+  AD::StopEvaluationTimer();
+
+  /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
+
+  iteration->IterateDiscAdj(geometry_container, solver_container,
+                            config_container, ZONE_0, INST_0, false);
+
+  /*--- Clear the stored adjoint information to be ready for a new evaluation. ---*/
+
+  AD::ClearAdjoints();
+
+}
+
+unsigned long CDiscAdjSinglezoneDriver::KrylovCorrection(unsigned long maxIter) {
+
+  /*--- The last iteration moved the solution from x0 to x1 = x0 + r (G^T x0 + g - x0), where g is the
+   * gradient of the objective function and r the relaxation factor. The correction d such that x0 + d
+   * solves the adjoint system x = G^T x + g satisfies r (G^T d - d) = x0 - x1. ---*/
+
+  GetAllSolutions(ZONE_0, true, AdjSol);
+  AdjRHS = AdjStart;
+  AdjRHS -= AdjSol;
+  AdjSol.SetValZero();
+
+  passivedouble eps = 0.0;
+  const auto iter = LinSolver.FGMRES_LinSolver(AdjRHS, AdjSol, AdjointProduct(this), Identity(),
+                                               KrylovTol, maxIter, eps, false, config);
+
+  /*--- The next iteration starts from the corrected solution and gives its residual. ---*/
+
+  AdjSol += AdjStart;
+  SetAllSolutions(ZONE_0, true, AdjSol);
+
+  return iter;
 }
 
 void CDiscAdjSinglezoneDriver::Postprocess() {
@@ -248,6 +336,7 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   AD::Reset();
+  AD::ResetTapePhases(kind_recording != RECORDING::CLEAR_INDICES && config_container[ZONE_0]->GetWrt_AD_Statistics());
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -318,6 +407,7 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
       }
     }
 #endif
+    AD::PrintTapePhases();
   }
 
   AD::StopRecording();
@@ -461,3 +551,142 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::PrepareDirectSolutions() {
+
+  const bool secondOrder = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+  const int directIter = static_cast<int>(config->GetUnst_AdjointIter()) - static_cast<int>(TimeIter) - 1;
+
+  /*--- Same sequence as CDiscAdjFluidIteration::Preprocess, the first adjoint time iteration needs the
+   *    solutions at n, n-1 (and n-2), the following ones only the oldest time level. ---*/
+
+  const int oldest = directIter - 1 - secondOrder;
+  const int newest = (TimeIter == 0) ? directIter : oldest;
+
+  directSolutions.clear();
+  if (newest < 0) return;
+
+  /*--- The recomputation overwrites the time levels that the adjoint iteration shifts, and the iteration
+   *    counters of the config. ---*/
+
+  su2passivematrix currentState;
+  GetDirectTimeLevels(currentState);
+  const auto physicalTime = config->GetPhysicalTime();
+
+  for (int iter = newest; iter >= max(oldest, 0); --iter) {
+    ComputeDirectSolution(iter, directSolutions[iter]);
+  }
+
+  SetDirectTimeLevels(currentState);
+  config->SetTimeIter(TimeIter);
+  config->SetPhysicalTime(physicalTime);
+  config->SetInnerIter(0);
+}
+
+void CDiscAdjSinglezoneDriver::ComputeDirectSolution(int directIter, su2passivematrix& solution) {
+
+  /*--- Start from the closest stored state, or from the restart file of the first time step, such that
+   *    restarted direct runs or custom initial conditions are reproduced. As for the restart-file path,
+   *    the time level before it is the freestream. ---*/
+
+  const int start = directSchedule->Restore(directIter);
+  directCheckpoints.erase(directCheckpoints.upper_bound(directIter), directCheckpoints.end());
+
+  if (start >= 0) {
+    SetDirectTimeLevels(directCheckpoints.at(start));
+  } else {
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+      if (!solver[iSol] || solver[iSol]->GetAdjoint()) continue;
+      solver[iSol]->SetFreeStream_Solution(config);
+      solver[iSol]->GetNodes()->Set_Solution_time_n();
+    }
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+      if (!solver[iSol] || solver[iSol]->GetAdjoint()) continue;
+      solver[iSol]->LoadRestart(geometry_container[ZONE_0][INST_0], solver_container[ZONE_0][INST_0], config, 0,
+                                iSol == FLOW_SOL);
+      solver[iSol]->GetNodes()->Set_Solution_time_n1();
+      solver[iSol]->GetNodes()->Set_Solution_time_n();
+    }
+    if (directSchedule->Store(0, directIter)) GetDirectTimeLevels(directCheckpoints[0]);
+  }
+  const int first = max(start, 0) + 1;
+
+  if (rank == MASTER_NODE && first <= directIter) {
+    cout << " Computing direct iterations " << first << " to " << directIter << " from the state of iteration "
+         << max(start, 0) << (start < 0 ? " (restart file)." : ".") << endl;
+  }
+
+  /*--- Advance, the schedule decides which intermediate states are stored. ---*/
+
+  for (int iter = first; iter <= directIter; ++iter) {
+    DirectTimeStep(iter);
+    if (directSchedule->Store(iter, directIter)) GetDirectTimeLevels(directCheckpoints[iter]);
+  }
+
+  solution.resize(geometry->GetnPoint(), GetTotalNumberOfVariables(ZONE_0, false));
+  GetAllSolutions(ZONE_0, false, solution);
+}
+
+void CDiscAdjSinglezoneDriver::DirectTimeStep(int directIter) {
+
+  config->SetTimeIter(directIter);
+  config->SetPhysicalTime(static_cast<su2double>(directIter) * config->GetDelta_UnstTimeND());
+
+  direct_iteration->Preprocess(direct_output, integration_container, geometry_container, solver_container,
+                               numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                               ZONE_0, INST_0);
+
+  /*--- A fixed number of inner iterations makes the recomputed states identical to the stored ones. ---*/
+
+  for (auto iInner = 0ul; iInner < config->GetnInner_Iter(); ++iInner) {
+    config->SetInnerIter(iInner);
+    direct_iteration->Iterate(direct_output, integration_container, geometry_container, solver_container,
+                              numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                              ZONE_0, INST_0);
+  }
+
+  direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container,
+                           numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                           ZONE_0, INST_0);
+}
+
+void CDiscAdjSinglezoneDriver::GetDirectTimeLevels(su2passivematrix& state) const {
+
+  const bool secondOrder = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+  const auto nPoint = geometry->GetnPoint();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, false);
+  state.resize(nPoint, (1 + secondOrder) * nVar);
+
+  for (auto iSol = 0u, offset = 0u; iSol < MAX_SOLS; ++iSol) {
+    if (!solver[iSol] || solver[iSol]->GetAdjoint()) continue;
+    const auto* nodes = solver[iSol]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < solver[iSol]->GetnVar(); ++iVar) {
+        state(iPoint, offset + iVar) = SU2_TYPE::GetValue(nodes->GetSolution_time_n(iPoint, iVar));
+        if (secondOrder)
+          state(iPoint, nVar + offset + iVar) = SU2_TYPE::GetValue(nodes->GetSolution_time_n1(iPoint, iVar));
+      }
+    }
+    offset += solver[iSol]->GetnVar();
+  }
+}
+
+void CDiscAdjSinglezoneDriver::SetDirectTimeLevels(const su2passivematrix& state) {
+
+  const bool secondOrder = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+  const auto nPoint = geometry->GetnPoint();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, false);
+
+  for (auto iSol = 0u, offset = 0u; iSol < MAX_SOLS; ++iSol) {
+    if (!solver[iSol] || solver[iSol]->GetAdjoint()) continue;
+    auto* nodes = solver[iSol]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < solver[iSol]->GetnVar(); ++iVar) {
+        nodes->SetSolution(iPoint, iVar, state(iPoint, offset + iVar));
+        nodes->Set_Solution_time_n(iPoint, iVar, state(iPoint, offset + iVar));
+        if (secondOrder) nodes->Set_Solution_time_n1(iPoint, iVar, state(iPoint, nVar + offset + iVar));
+      }
+    }
+    offset += solver[iSol]->GetnVar();
+  }
+}
@@ -116,7 +116,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   /*--- Preprocessing of the config files. ---*/
 
+  PreprocProfiler.Start("Input");
   PreprocessInput(config_container, driver_config);
+  PreprocProfiler.Stop();
 
   /*--- Retrieve dimension from mesh file ---*/
 
@@ -125,7 +127,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   /*--- Output preprocessing ---*/
 
+  PreprocProfiler.Start("Output");
   PreprocessOutput(config_container, driver_config, output_container, driver_output);
+  PreprocProfiler.Stop();
 
 
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -155,7 +159,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
+      PreprocProfiler.Start("Geometry");
       InitializeGeometry(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      PreprocProfiler.Stop();
 
     }
   }
@@ -165,7 +171,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
-  CGeometry::ComputeWallDistance(config_container, geometry_container);
+  PreprocProfiler.Start("Wall distance");
+  CGeometry::ComputeWallDistance(config_container, geometry_container, true);
+  PreprocProfiler.Stop();
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -178,7 +186,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        fluxes, loops over the nodes to compute source terms, and routines for
        imposing various boundary condition type for the PDE. ---*/
 
+      PreprocProfiler.Start("Solver");
       InitializeSolver(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      PreprocProfiler.Stop();
 
       /*--- Definition of the numerical method class:
        numerics_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
@@ -187,8 +197,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
 
+      PreprocProfiler.Start("Numerics");
       InitializeNumerics(config_container[iZone], geometry_container[iZone][iInst],
                              solver_container[iZone][iInst], numerics_container[iZone][iInst]);
+      PreprocProfiler.Stop();
 
       /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
        The integration class orchestrates the execution of the spatial integration
@@ -208,12 +220,14 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
       /*--- Dynamic mesh processing.  ---*/
 
+      PreprocProfiler.Start("Mesh motion");
       PreprocessDynamicMesh(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
                                 iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
 
       /*--- Static mesh processing.  ---*/
 
       PreprocessStaticMesh(config_container[iZone], geometry_container[iZone][iInst]);
+      PreprocProfiler.Stop();
 
     }
 
@@ -230,8 +244,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    PreprocProfiler.Start("Interface");
     InitializeInterface(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    PreprocProfiler.Stop();
   }
 
   if (fsi) {
@@ -247,7 +263,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     if (rank == MASTER_NODE)
       cout << endl <<"---------------------- Turbomachinery Preprocessing ---------------------" << endl;
 
+    PreprocProfiler.Start("Turbomachinery");
     PreprocessTurbomachinery(config_container, geometry_container, solver_container, interface_container, dummy_geo);
+    PreprocProfiler.Stop();
   } else {
     mixingplane = false;
   }
@@ -288,6 +306,16 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   UsedTime = StopTime-StartTime;
   UsedTimePreproc = UsedTime;
 
+  /*--- Report the time and memory of each preprocessing phase. ---*/
+
+  const bool wrt_profile = config_container[ZONE_0]->GetWrt_Preproc_Profile();
+  const auto& profileFile = config_container[ZONE_0]->GetPreproc_Profile_FileName();
+  if (wrt_profile || !profileFile.empty()) {
+    ostringstream title;
+    title << "Preprocessing profile, total time " << UsedTimePreproc << " s";
+    PreprocProfiler.Report(title.str(), profileFile, wrt_profile ? &cout : nullptr);
+  }
+
   /*--- Reset timer for compute performance benchmarking. ---*/
 
   StartTime = SU2_MPI::Wtime();
@@ -707,7 +735,9 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
+  PreprocProfiler.Start("Mesh reading");
   CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  PreprocProfiler.Stop();
 
   /*--- Set the dimension --- */
 
@@ -715,7 +745,9 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
 
+  PreprocProfiler.Start("Partitioning");
   geometry_aux->SetColorGrid_Parallel(config);
+  PreprocProfiler.Stop();
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -724,6 +756,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Build the grid data structures using the ParMETIS coloring. ---*/
 
+  PreprocProfiler.Start("Distribution");
   geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
 
   /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
@@ -735,16 +768,23 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetBoundaries(config);
+  PreprocProfiler.Stop();
 
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
+  PreprocProfiler.Start("Connectivity and ordering");
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee ordering or a space-filling curve ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (config->GetKind_Point_Ordering() == POINT_ORDERING::RCM) {
+    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+    geometry[MESH_0]->SetRCM_Ordering(config);
+  } else {
+    if (rank == MASTER_NODE) cout << "Renumbering points and elements (space-filling curve)." << endl;
+    geometry[MESH_0]->SetSFC_Ordering(config);
+  }
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -764,21 +804,33 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[MESH_0]->Check_IntElem_Orientation(config);
     geometry[MESH_0]->Check_BoundElem_Orientation(config);
   }
+  PreprocProfiler.Stop();
+
+  /*--- Store our multigrid index. ---*/
+
+  geometry[MESH_0]->SetMGLevel(MESH_0);
 
   /*--- Create the edge structure ---*/
 
+  PreprocProfiler.Start("Edges");
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
+  if (config->GetKind_Edge_Ordering() != EDGE_ORDERING::NATURAL && rank == MASTER_NODE)
+    cout << "Renumbering edges (blocked ordering)." << endl;
+  geometry[MESH_0]->SetEdgeOrdering(config);
   geometry[MESH_0]->SetVertex(config);
+  PreprocProfiler.Stop();
 
   /*--- Create the control volume structures ---*/
 
   if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
+  PreprocProfiler.Start("Control volumes");
   SU2_OMP_PARALLEL {
     geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
     geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
   }
   END_SU2_OMP_PARALLEL
+  PreprocProfiler.Stop();
 
   /*--- Visualize a dual control volume if requested ---*/
 
@@ -788,6 +840,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Identify closest normal neighbor ---*/
 
+  PreprocProfiler.Start("Surfaces and mesh quality");
   if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
   geometry[MESH_0]->FindNormal_Neighbor(config);
 
@@ -819,10 +872,11 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
       cout << "Computing mesh quality statistics for the dual control volumes." << endl;
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
   }
+  PreprocProfiler.Stop();
 
-  geometry[MESH_0]->SetMGLevel(MESH_0);
   if ((config->GetnMGLevels() != 0) && (rank == MASTER_NODE))
     cout << "Setting the multigrid structure." << endl;
+  PreprocProfiler.Start("Multigrid");
 
   /*--- Loop over all the new grid ---*/
 
@@ -832,6 +886,10 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
     geometry[iMGlevel] = new CMultiGridGeometry(geometry[iMGlevel-1], config, iMGlevel);
 
+    /*--- Store our multigrid index. ---*/
+
+    geometry[iMGlevel]->SetMGLevel(iMGlevel);
+
     /*--- Compute points surrounding points. ---*/
 
     geometry[iMGlevel]->SetPoint_Connectivity(geometry[iMGlevel-1]);
@@ -839,6 +897,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     /*--- Create the edge structure ---*/
 
     geometry[iMGlevel]->SetEdges();
+    geometry[iMGlevel]->SetEdgeOrdering(config);
     geometry[iMGlevel]->SetVertex(geometry[iMGlevel-1], config);
 
     /*--- Create the control volume structures ---*/
@@ -851,10 +910,6 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
     geometry[iMGlevel]->FindNormal_Neighbor(config);
 
-    /*--- Store our multigrid index. ---*/
-
-    geometry[iMGlevel]->SetMGLevel(iMGlevel);
-
     /*--- Protect against the situation that we were not able to complete
        the agglomeration for this level, i.e., there weren't enough points.
        We need to check if we changed the total number of levels and delete
@@ -868,6 +923,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   }
 
+  PreprocProfiler.Stop();
+
   if (config->GetWrt_MultiGrid()) geometry[MESH_0]->ColorMGLevels(config->GetnMGLevels(), geometry);
 
   /*--- For unsteady simulations, initialize the grid volumes
@@ -891,6 +948,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Create the data structure for MPI point-to-point communications. ---*/
 
+  PreprocProfiler.Start("Communications");
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
     geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
 
@@ -915,6 +973,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[iMGlevel]->InitiateComms(geometry[iMGlevel], config, NEIGHBORS);
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
   }
+  PreprocProfiler.Stop();
 
 }
 
@@ -46,8 +46,11 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
+  const auto& solverName = solver_container[MainSolver]->GetSolverName();
+
   /*--- Compute inviscid residuals ---*/
 
+  AD::StartTapePhase(solverName, "convective fluxes");
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -56,17 +59,25 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
       break;
   }
+  AD::EndTapePhase();
 
   /*--- Compute viscous residuals ---*/
+  AD::StartTapePhase(solverName, "viscous fluxes");
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  AD::EndTapePhase();
 
   /*--- Compute source term residuals ---*/
+  AD::StartTapePhase(solverName, "source terms");
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  AD::EndTapePhase();
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
-  if (dual_time)
+  if (dual_time) {
+    AD::StartTapePhase(solverName, "dual time");
     solver_container[MainSolver]->SetResidual_DualTime(geometry, solver_container, config, iRKStep, iMesh, RunTime_EqSystem);
+    AD::EndTapePhase();
+  }
 
   /*--- Pick convective and viscous numerics objects for the current thread. ---*/
 
@@ -77,6 +88,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /// TODO: Check if this is really needed.
   //const auto pausePreacc = (omp_get_num_threads() > 1) && AD::PausePreaccumulation();
 
+  AD::StartTapePhase(solverName, "boundary conditions");
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
@@ -196,6 +209,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
     solver_container[MainSolver]->BC_Periodic(geometry, solver_container, conv_bound_numerics, config);
   }
 
+  AD::EndTapePhase();
+
   //AD::ResumePreaccumulation(pausePreacc);
 
 }
@@ -73,6 +73,7 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  adProducts = config->GetNewtonKrylovADProducts();
 
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
@@ -234,7 +235,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
   }
   else {
-    ComputeFinDiffStep();
+    if (!adProducts) ComputeFinDiffStep();
 
     eps *= toleranceFactor;
     iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, CMatrixFreeProductWrapper(this),
@@ -289,6 +290,11 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
 void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
 
+  if (adProducts) {
+    MatrixFreeProductAD(u, v);
+    return;
+  }
+
   Scalar factor = finDiffStep / u.norm();
 
   PerturbSolution(u, factor);
@@ -319,6 +325,47 @@ void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVect
   CSysMatrixComms::Complete(v, geometry, config);
 }
 
+void CNewtonIntegration::MatrixFreeProductAD(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+
+  auto& solution = solvers[FLOW_SOL]->GetNodes()->GetSolution();
+
+  /*--- Seed the (unperturbed) solution with the direction of the product. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar)
+      SU2_TYPE::SetDerivative(solution(iPoint,iVar), SU2_TYPE::GetValue(u(iPoint,iVar)));
+  }
+  END_SU2_OMP_FOR
+
+  ComputeResiduals(ResEvalType::EXPLICIT);
+
+  /*--- Finalize product, the residual was not flipped by the explicit evaluation. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    su2double delta = (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint)) /
+                      max(EPS, solvers[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint));
+    for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar) {
+      v(iPoint,iVar) = SU2_TYPE::GetDerivative(solvers[FLOW_SOL]->LinSysRes(iPoint,iVar)) +
+                       SU2_TYPE::GetValue(delta) * SU2_TYPE::GetValue(u(iPoint,iVar));
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Remove the seed, the state computed from the solution is re-evaluated before it is used again. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar)
+      SU2_TYPE::SetDerivative(solution(iPoint,iVar), 0.0);
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+}
+
 void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const {
 
   if (preconditioner) {
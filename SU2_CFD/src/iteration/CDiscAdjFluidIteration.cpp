@@ -282,7 +282,26 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
   auto geometries = geometry[iZone][iInst];
   const bool species = config[iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE;
 
-  if (DirectIter >= 0) {
+  if (DirectIter >= 0 && loadDirectSolution) {
+    if (rank == MASTER_NODE)
+      cout << " Setting flow solution of direct iteration " << DirectIter << " from memory for zone " << iZone << "." << endl;
+
+    /*--- The stored solutions include the halo points, the dependent variables are updated as for the restarts. ---*/
+
+    loadDirectSolution(DirectIter);
+
+    solvers[MESH_0][FLOW_SOL]->Preprocessing(geometries[MESH_0], solvers[MESH_0], config[iZone], MESH_0,
+                                             NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (turbulent) {
+      solvers[MESH_0][TURB_SOL]->Postprocessing(geometries[MESH_0], solvers[MESH_0], config[iZone], MESH_0);
+    }
+    if (species) {
+      solvers[MESH_0][SPECIES_SOL]->Postprocessing(geometries[MESH_0], solvers[MESH_0], config[iZone], MESH_0);
+    }
+    if (config[iZone]->GetWeakly_Coupled_Heat()) {
+      solvers[MESH_0][HEAT_SOL]->Postprocessing(geometries[MESH_0], solvers[MESH_0], config[iZone], MESH_0);
+    }
+  } else if (DirectIter >= 0) {
     if (rank == MASTER_NODE)
       cout << " Loading flow solution from direct iteration " << DirectIter << " for zone " << iZone << "." << endl;
 
@@ -87,6 +87,13 @@ CNumerics::ResidualType<> CCentLaxInc_Flow::ComputeResidual(const CConfig* confi
 
   implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+9); AD::SetPreaccIn(V_j, nDim+9); AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(Lambda_i, Lambda_j);
+  if (dynamic_grid) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   su2double U_i[5] = {0.0}, U_j[5] = {0.0};
   su2double ProjGridVel = 0.0, ProjVelocity = 0.0;
 
@@ -243,6 +250,9 @@ CNumerics::ResidualType<> CCentLaxInc_Flow::ComputeResidual(const CConfig* confi
     }
   }
 
+  AD::SetPreaccOut(ProjFlux, nVar);
+  AD::EndPreacc();
+
   return ResidualType<>(ProjFlux, Jacobian_i, Jacobian_j);
 
 }
@@ -310,6 +320,14 @@ CNumerics::ResidualType<> CCentJSTInc_Flow::ComputeResidual(const CConfig* confi
 
   implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+9); AD::SetPreaccIn(V_j, nDim+9); AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(Lambda_i, Lambda_j);
+  AD::SetPreaccIn(Sensor_i, Sensor_j); AD::SetPreaccIn(Und_Lapl_i, nVar); AD::SetPreaccIn(Und_Lapl_j, nVar);
+  if (dynamic_grid) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   su2double U_i[5] = {0.0}, U_j[5] = {0.0};
   su2double ProjGridVel = 0.0;
 
@@ -472,6 +490,9 @@ CNumerics::ResidualType<> CCentJSTInc_Flow::ComputeResidual(const CConfig* confi
     }
   }
 
+  AD::SetPreaccOut(ProjFlux, nVar);
+  AD::EndPreacc();
+
   return ResidualType<>(ProjFlux, Jacobian_i, Jacobian_j);
 
 }
@@ -105,6 +105,9 @@ CNumerics::ResidualType<> CUpwMSW_Flow::ComputeResidual(const CConfig* config) {
   su2double alpha, w, dp, onemw;
   su2double Proj_ModJac_Tensor_i, Proj_ModJac_Tensor_j;
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+5); AD::SetPreaccIn(V_j, nDim+5); AD::SetPreaccIn(Normal, nDim);
+
   /*--- Set parameters in the numerical method ---*/
   alpha = 6.0;
 
@@ -249,6 +252,9 @@ CNumerics::ResidualType<> CUpwMSW_Flow::ComputeResidual(const CConfig* config) {
     Fc_i[iVar] += Fc_j[iVar];
   }
 
+  AD::SetPreaccOut(Fc_i, nVar);
+  AD::EndPreacc();
+
   return ResidualType<>(Fc_i, Jacobian_i, Jacobian_j);
 
 }
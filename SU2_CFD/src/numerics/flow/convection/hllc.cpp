@@ -86,6 +86,12 @@ CNumerics::ResidualType<> CUpwHLLC_Flow::ComputeResidual(const CConfig* config)
 
   implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4); AD::SetPreaccIn(Normal, nDim);
+  if (dynamic_grid) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
 
   Area = GeometryToolbox::Norm(nDim, Normal);
@@ -550,6 +556,9 @@ CNumerics::ResidualType<> CUpwHLLC_Flow::ComputeResidual(const CConfig* config)
   }
   } // end if implicit
 
+  AD::SetPreaccOut(Flux, nVar);
+  AD::EndPreacc();
+
   return ResidualType<>(Flux, Jacobian_i, Jacobian_j);
 
 }
@@ -610,6 +619,13 @@ CNumerics::ResidualType<> CUpwGeneralHLLC_Flow::ComputeResidual(const CConfig* c
 
   implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4); AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(S_i, 2); AD::SetPreaccIn(S_j, 2);
+  if (dynamic_grid) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
 
   Area = GeometryToolbox::Norm(nDim, Normal);
@@ -1103,6 +1119,9 @@ CNumerics::ResidualType<> CUpwGeneralHLLC_Flow::ComputeResidual(const CConfig* c
   }
   } // end if implicit
 
+  AD::SetPreaccOut(Flux, nVar);
+  AD::EndPreacc();
+
   return ResidualType<>(Flux, Jacobian_i, Jacobian_j);
 
 }
@@ -31,6 +31,7 @@
 #include "../../include/output/COutput.hpp"
 #include "../../include/output/CTurboOutput.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../include/output/filewriter/CExtractFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
 #include "../../include/output/filewriter/CSurfaceFVMDataSorter.hpp"
@@ -45,7 +46,11 @@
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2CompressedFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../include/output/tools/CAsyncFileWriter.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   rank(SU2_MPI::GetRank()),
@@ -168,8 +173,20 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   volumeDataSorter = nullptr;
   surfaceDataSorter = nullptr;
+  extractDataSorter = nullptr;
 
   headerNeeded = false; 
+
+  /*--- The background writer is created with the first volume output, only report here (once for all zones)
+   *    if it is not available. ---*/
+
+  static bool asyncWarned = false;
+  if (config->GetOutput_Async() && !CAsyncFileWriter::IsSupported() && !asyncWarned) {
+    asyncWarned = true;
+    if (rank == MASTER_NODE)
+      cout << "WARNING: OUTPUT_ASYNC requires thread-safe MPI (SU2_CFD --thread_multiple) and is not "
+              "available for the discrete adjoint, the output files are written synchronously." << endl;
+  }
 }
 
 COutput::~COutput() {
@@ -180,6 +197,10 @@ COutput::~COutput() {
   delete historyFileTable;
   delete volumeDataSorter;
   delete surfaceDataSorter;
+  delete extractDataSorter;
+
+  /*--- Waits for the files that are still being written. ---*/
+  delete asyncWriter;
 
 }
 
@@ -345,6 +366,49 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
 }
 
+void COutput::AllocateExtractDataSorter(CConfig *config, CGeometry *geometry){
+
+  if (femOutput)
+    SU2_MPI::Error("The EXTRACT_* output files are only available for finite volume solvers.", CURRENT_FUNCTION);
+
+  /*--- The coordinates come first, followed by the requested fields (or groups), all fields if none. ---*/
+
+  vector<string> fieldNames;
+  vector<unsigned short> fieldIndices;
+
+  const auto nRequested = config->GetnExtract_Fields();
+  const auto* requested = config->GetExtract_Fields();
+
+  auto isRequested = [&](const string& name, const VolumeOutputField& field) {
+    if (field.outputGroup == "COORDINATES") return true;
+    if (nRequested == 0) return true;
+    for (unsigned short i = 0; i < nRequested; i++) {
+      if (requested[i] == name || requested[i] == field.outputGroup) return true;
+    }
+    return false;
+  };
+
+  for (const bool coordinates : {true, false}) {
+    for (const auto& name : volumeOutput_List) {
+      const auto& field = volumeOutput_Map.at(name);
+      if (field.offset < 0 || (field.outputGroup == "COORDINATES") != coordinates) continue;
+      if (!isRequested(name, field)) continue;
+      fieldNames.push_back(field.fieldName);
+      fieldIndices.push_back(field.offset);
+    }
+  }
+
+  int isoField = -1;
+  const auto it = volumeOutput_Map.find(config->GetExtract_IsoField());
+  if (it != volumeOutput_Map.end()) isoField = it->second.offset;
+
+  /*--- The selection depends on the current data (and coordinates), hence it is done for every file. ---*/
+
+  delete extractDataSorter;
+  extractDataSorter = new CExtractFVMDataSorter(config, geometry, dynamic_cast<CFVMDataSorter*>(volumeDataSorter),
+                                                fieldNames, fieldIndices, isoField);
+}
+
 void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_container){
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
@@ -430,8 +494,13 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       if (!config->GetWrt_Restart_Overwrite())
         filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
 
-      LogOutputFiles("SU2 binary restart");
-      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      if (config->GetRestart_Compression() == RESTART_COMPRESSION::NONE) {
+        LogOutputFiles("SU2 binary restart");
+        fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      } else {
+        LogOutputFiles("SU2 compressed restart");
+        fileWriter = new CSU2CompressedFileWriter(volumeDataSorter, GetRestartDroppedBits(config));
+      }
 
       break;
 
@@ -454,6 +523,63 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2BinaryMeshFileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2BinaryMeshFileWriter(volumeDataSorter, config->GetiZone(), config->GetnZone());
+
+      break;
+
+    case OUTPUT_TYPE::EXTRACT_PARAVIEW:
+
+      extension = CParaviewXMLFileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename + "_extract", "", curTimeIter);
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Select, load, and sort the extracted data, the connectivity is set by the selection. ---*/
+
+      AllocateExtractDataSorter(config, geometry);
+      extractDataSorter->SortOutputData();
+
+      LogOutputFiles("Paraview extract");
+      fileWriter = new CParaviewXMLFileWriter(extractDataSorter);
+
+      break;
+
+    case OUTPUT_TYPE::EXTRACT_CSV:
+
+      extension = CSU2FileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename + "_extract", "", curTimeIter);
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      AllocateExtractDataSorter(config, geometry);
+      extractDataSorter->SortOutputData();
+
+      LogOutputFiles("CSV extract");
+      fileWriter = new CSU2FileWriter(extractDataSorter);
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
@@ -738,7 +864,30 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       break;
   }
 
-  if (fileWriter != nullptr) {
+  /*--- Formats that can be written in the background, see CFileWriter::SetDeferredIO. ---*/
+
+  const bool async = (asyncWriter != nullptr) &&
+                     (format == OUTPUT_TYPE::RESTART_BINARY || format == OUTPUT_TYPE::MESH_BINARY ||
+                      format == OUTPUT_TYPE::PARAVIEW_XML || format == OUTPUT_TYPE::SURFACE_PARAVIEW_XML ||
+                      format == OUTPUT_TYPE::EXTRACT_PARAVIEW ||
+                      format == OUTPUT_TYPE::PARAVIEW_LEGACY_BINARY ||
+                      format == OUTPUT_TYPE::SURFACE_PARAVIEW_LEGACY_BINARY ||
+                      format == OUTPUT_TYPE::CGNS || format == OUTPUT_TYPE::SURFACE_CGNS);
+
+  if (fileWriter != nullptr && async) {
+
+    /*--- The writer only records the file operations (with a copy of the data), which are then
+     *    executed in the background. The bandwidth is not meaningful in this case. ---*/
+
+    asyncWriter->Prepare(fileWriter);
+
+    fileWriter->WriteData(fileName);
+
+    if (!filename_iter.empty()) fileWriter->WriteData(filename_iter);
+
+    asyncWriter->Push(fileWriter);
+
+  } else if (fileWriter != nullptr) {
 
     /*--- Write data to file ---*/
 
@@ -773,6 +922,36 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
 }
 
+vector<int> COutput::GetRestartDroppedBits(const CConfig *config) const {
+
+  vector<int> droppedBits(nVolumeFields, 0);
+
+  if (config->GetRestart_Compression() != RESTART_COMPRESSION::LOSSY) return droppedBits;
+
+  /*--- Only the fields that are not read back by the solvers are compressed lossily. ---*/
+
+  const int nBits = CompressionToolbox::DroppedBits(SU2_TYPE::GetValue(config->GetRestart_Compression_Tol()));
+
+  for (const auto& name : volumeOutput_List) {
+    const auto& field = volumeOutput_Map.at(name);
+    if (field.offset < 0) continue;
+    if (!IsRestartField(name, field.outputGroup)) droppedBits[field.offset] = nBits;
+  }
+  return droppedBits;
+}
+
+bool COutput::IsRestartField(const string& name, const string& group) {
+
+  /*--- What the LoadRestart methods of the solvers read, besides the solution, coordinates, grid velocities,
+   *    and sensitivities, the FEA velocities and accelerations and the LM intermittencies. ---*/
+
+  static const set<string> restartGroups = {"COORDINATES", "SOLUTION", "GRID_VELOCITY", "SENSITIVITY",
+                                            "VELOCITY", "ACCELERATION"};
+  static const set<string> restartFields = {"INTERMITTENCY_SEP", "INTERMITTENCY_EFF"};
+
+  return (restartGroups.count(group) > 0) || (restartFields.count(name) > 0);
+}
+
 bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
   if(!cauchyTimeConverged && TimeConvergence && config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND){
     // Change flags for 2nd order Time stepping: In case of convergence, this iter and next iter gets written out. then solver stops
@@ -808,9 +987,17 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
     }
     if (!write_file) continue;
 
-    /*--- Partition and sort the data --- */
+    /*--- Partition and sort the data, the extract files only communicate the selected points. --- */
+
+    if (!isExtract(VolumeFiles[iFile])) volumeDataSorter->SortOutputData();
 
-    volumeDataSorter->SortOutputData();
+    /*--- With background writing, the files of the previous output must be complete before new
+     *    ones are queued, this bounds the memory used by the copies of the data. ---*/
+
+    if (config->GetOutput_Async() && !isFileWrite && CAsyncFileWriter::IsSupported()) {
+      if (asyncWriter == nullptr) asyncWriter = new CAsyncFileWriter();
+      asyncWriter->Wait();
+    }
 
     if (rank == MASTER_NODE && !isFileWrite) {
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
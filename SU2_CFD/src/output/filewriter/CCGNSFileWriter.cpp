@@ -25,6 +25,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <memory>
+
 #include "../../../include/output/filewriter/CCGNSFileWriter.hpp"
 
 const string CCGNSFileWriter::fileExt = ".cgns";
@@ -70,7 +72,7 @@ void CCGNSFileWriter::WriteData(string val_filename) {
   }
 
   /*--- Close the CGNS file. ---*/
-  if (rank == MASTER_NODE) CallCGNS(cg_close(cgnsFileID));
+  if (rank == MASTER_NODE) RunOrDefer([this]() { CallCGNS(cg_close(cgnsFileID)); });
 
 #endif
 }
@@ -90,7 +92,16 @@ void CCGNSFileWriter::InitializeMeshFile(const string& val_filename) {
   /*--- If surface file cell dimension is decreased. ---*/
   const auto nCell = static_cast<int>(nDim - isSurface);
 
-  if (rank == MASTER_NODE) {
+  if (rank != MASTER_NODE) return;
+
+  /*--- Create Zone data. ---*/
+  array<cgsize_t, 3> zoneData;
+
+  zoneData[0] = GlobalPoint;
+  zoneData[1] = GlobalElem;
+  zoneData[2] = 0;
+
+  RunOrDefer([=]() {
     /*--- Remove the previous file if present. ---*/
     remove(val_filename.c_str());
 
@@ -101,14 +112,9 @@ void CCGNSFileWriter::InitializeMeshFile(const string& val_filename) {
     CallCGNS(cg_base_write(cgnsFileID, "Base", nCell, nDim, &cgnsBase));
 
     /*--- Create Zone. ---*/
-    array<cgsize_t, 3> zoneData;
-
-    zoneData[0] = GlobalPoint;
-    zoneData[1] = GlobalElem;
-    zoneData[2] = 0;
-
-    CallCGNS(cg_zone_write(cgnsFileID, cgnsBase, "Zone", zoneData.data(), Unstructured, &cgnsZone));
-  }
+    auto zone = zoneData;
+    CallCGNS(cg_zone_write(cgnsFileID, cgnsBase, "Zone", zone.data(), Unstructured, &cgnsZone));
+  });
 }
 
 void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
@@ -131,17 +137,7 @@ void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
   /*--- Coordinate vector is written in blocks, one for each process. ---*/
   cgsize_t nodeBegin = 1;
   auto nodeEnd = static_cast<cgsize_t>(nLocalPoints);
-  if (nLocalPoints > 0) {
-    if (isCoord) {
-      int CoordinateNumber;
-      CallCGNS(cg_coord_partial_write(cgnsFileID, cgnsBase, cgnsZone, dataType, FieldName.c_str(), &nodeBegin, &nodeEnd,
-                                      sendBufferField.data(), &CoordinateNumber));
-    } else {
-      int fieldNumber;
-      CallCGNS(cg_field_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsFields, dataType, FieldName.c_str(), &nodeBegin,
-                                      &nodeEnd, sendBufferField.data(), &fieldNumber));
-    }
-  }
+  if (nLocalPoints > 0) WriteFieldBlock(isCoord, FieldName, nodeBegin, nodeEnd, sendBufferField);
 
   for (int i = 0; i < size; ++i) {
     if (i == MASTER_NODE) continue;
@@ -155,15 +151,7 @@ void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
     SU2_MPI::Recv(recvBufferField.data(), recvSize * sizeof(dataPrecision), MPI_CHAR, i, 0, SU2_MPI::GetComm(),
                   MPI_STATUS_IGNORE);
     if (recvSize <= 0) continue;
-    if (isCoord) {
-      int CoordinateNumber;
-      CallCGNS(cg_coord_partial_write(cgnsFileID, cgnsBase, cgnsZone, dataType, FieldName.c_str(), &nodeBegin, &nodeEnd,
-                                      recvBufferField.data(), &CoordinateNumber));
-    } else {
-      int fieldNumber;
-      CallCGNS(cg_field_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsFields, dataType, FieldName.c_str(),
-                                      &nodeBegin, &nodeEnd, recvBufferField.data(), &fieldNumber));
-    }
+    WriteFieldBlock(isCoord, FieldName, nodeBegin, nodeEnd, recvBufferField);
   }
 }
 
@@ -177,10 +165,12 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
   cgsize_t firstElem = cumulative + 1;
   cgsize_t endElem = cumulative + static_cast<cgsize_t>(nTotElem);
 
-  int cgnsSection;
-  if (rank == MASTER_NODE)
-    CallCGNS(cg_section_partial_write(cgnsFileID, cgnsBase, cgnsZone, SectionName.c_str(), elementType, firstElem,
-                                      endElem, 0, &cgnsSection));
+  if (rank == MASTER_NODE) {
+    RunOrDefer([=]() {
+      CallCGNS(cg_section_partial_write(cgnsFileID, cgnsBase, cgnsZone, SectionName.c_str(), elementType, firstElem,
+                                        endElem, 0, &cgnsSection));
+    });
+  }
 
   /*--- Retrieve element distribution among processes. ---*/
   const auto nLocalElem = dataSorter->GetnElem(type);
@@ -210,9 +200,7 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
   }
 
   /*--- Connectivity vector is written in blocks, one for each process. ---*/
-  if (nLocalElem > 0)
-    CallCGNS(cg_elements_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsSection, firstElem, endElem,
-                                       sendBufferConnectivity.data()));
+  if (nLocalElem > 0) WriteConnectivityBlock(firstElem, endElem, sendBufferConnectivity);
 
   for (int i = 0; i < size; ++i) {
     if (i == MASTER_NODE) continue;
@@ -225,15 +213,43 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
     const auto recvByte = static_cast<int>(recvBufferConnectivity.size() * sizeof(cgsize_t));
     SU2_MPI::Recv(recvBufferConnectivity.data(), recvByte, MPI_CHAR, i, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
 
-    if (!recvBufferConnectivity.empty())
-      CallCGNS(cg_elements_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsSection, firstElem, endElem,
-                                         recvBufferConnectivity.data()));
+    if (!recvBufferConnectivity.empty()) WriteConnectivityBlock(firstElem, endElem, recvBufferConnectivity);
   }
   cumulative += static_cast<cgsize_t>(nTotElem);
 }
 
 void CCGNSFileWriter::InitializeFields() {
   /*--- Create "Fields" node to store solution. ---*/
-  if (rank == MASTER_NODE) CallCGNS(cg_sol_write(cgnsFileID, cgnsBase, cgnsZone, "Fields", Vertex, &cgnsFields));
+  if (rank == MASTER_NODE)
+    RunOrDefer([this]() { CallCGNS(cg_sol_write(cgnsFileID, cgnsBase, cgnsZone, "Fields", Vertex, &cgnsFields)); });
+}
+
+void CCGNSFileWriter::WriteFieldBlock(bool isCoord, const string& FieldName, cgsize_t nodeBegin, cgsize_t nodeEnd,
+                                      vector<dataPrecision>& buffer) {
+  /*--- The operation may be executed after the buffer is reused. ---*/
+  const auto data = make_shared<vector<dataPrecision> >(std::move(buffer));
+  buffer.clear();
+
+  RunOrDefer([=]() {
+    auto begin = nodeBegin, end = nodeEnd;
+    if (isCoord) {
+      int CoordinateNumber;
+      CallCGNS(cg_coord_partial_write(cgnsFileID, cgnsBase, cgnsZone, dataType, FieldName.c_str(), &begin, &end,
+                                      data->data(), &CoordinateNumber));
+    } else {
+      int fieldNumber;
+      CallCGNS(cg_field_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsFields, dataType, FieldName.c_str(), &begin,
+                                      &end, data->data(), &fieldNumber));
+    }
+  });
+}
+
+void CCGNSFileWriter::WriteConnectivityBlock(cgsize_t firstElem, cgsize_t endElem, vector<cgsize_t>& buffer) {
+  const auto data = make_shared<vector<cgsize_t> >(std::move(buffer));
+  buffer.clear();
+
+  RunOrDefer([=]() {
+    CallCGNS(cg_elements_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsSection, firstElem, endElem, data->data()));
+  });
 }
 #endif  // HAVE_CGNS
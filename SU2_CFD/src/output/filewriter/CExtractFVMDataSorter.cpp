@@ -0,0 +1,331 @@
+/*!
+ * \file CExtractFVMDataSorter.cpp
+ * \brief Datasorter for the extracted part of the FVM volume output.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CExtractFVMDataSorter.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace {
+constexpr auto NOT_EXTRACTED = std::numeric_limits<unsigned long>::max();
+}
+
+CExtractFVMDataSorter::CExtractFVMDataSorter(CConfig *config, CGeometry *geometry,
+                                             const CFVMDataSorter* valVolumeSorter,
+                                             const vector<string> &valFieldNames,
+                                             const vector<unsigned short> &valVolumeFields,
+                                             int isoField) :
+  CParallelDataSorter(config, valFieldNames),
+  volumeSorter(valVolumeSorter),
+  volumeFields(valVolumeFields) {
+
+  nDim = geometry->GetnDim();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto kind = config->GetKind_Extract();
+  const auto* box = config->GetExtract_Box();
+  const auto* plane = config->GetExtract_Plane();
+  const passivedouble isoValue = SU2_TYPE::GetValue(config->GetExtract_IsoValue());
+
+  if (kind == EXTRACT_KIND::ISOSURFACE && isoField < 0)
+    SU2_MPI::Error("The EXTRACT_ISOSURFACE_FIELD is not part of the volume output.", CURRENT_FUNCTION);
+
+  /*--- The volume data sorter only holds the domain points, the iso-field values of the halo points
+   *    are received from the ranks that own them, since the elements kept by this rank may contain
+   *    halo points (see CFVMDataSorter::SetHaloPoints). ---*/
+
+  vector<passivedouble> isoValues;
+  if (kind == EXTRACT_KIND::ISOSURFACE) {
+    isoValues.resize(nPoint, 0.0);
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      isoValues[iPoint] = volumeSorter->GetUnsortedData(iPoint, isoField) - isoValue;
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) || (config->GetMarker_All_SendRecv(iMarker) < 0))
+        continue;
+      const auto MarkerS = iMarker;
+      const auto MarkerR = iMarker + 1;
+
+      const auto send_to = config->GetMarker_All_SendRecv(MarkerS) - 1;
+      const auto receive_from = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
+
+      const auto nVertexS = geometry->nVertex[MarkerS];
+      const auto nVertexR = geometry->nVertex[MarkerR];
+
+      vector<passivedouble> bufSend(nVertexS), bufRecv(nVertexR);
+      for (unsigned long iVertex = 0; iVertex < nVertexS; iVertex++)
+        bufSend[iVertex] = isoValues[geometry->vertex[MarkerS][iVertex]->GetNode()];
+
+      SU2_MPI::Sendrecv(bufSend.data(), nVertexS, MPI_DOUBLE, send_to, 0, bufRecv.data(), nVertexR, MPI_DOUBLE,
+                        receive_from, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+      for (unsigned long iVertex = 0; iVertex < nVertexR; iVertex++)
+        isoValues[geometry->vertex[MarkerR][iVertex]->GetNode()] = bufRecv[iVertex];
+    }
+  }
+
+  /*--- Select the elements on this partition. As in CFVMDataSorter, elements with halo points are
+   *    left to the rank that keeps them. The coordinates and iso-field values are known at all the
+   *    points of the other elements (domain and kept halo points). ---*/
+
+  const unsigned short elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+
+  auto isValidType = [&](unsigned short type) {
+    for (auto t : elemTypes) if (t == type) return true;
+    return false;
+  };
+
+  auto isSelected = [&](unsigned long iElem) {
+    const auto* elem = geometry->elem[iElem];
+    passivedouble minVal = std::numeric_limits<passivedouble>::max();
+    passivedouble maxVal = std::numeric_limits<passivedouble>::lowest();
+
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+      const auto iPoint = elem->GetNode(iNode);
+      const auto* coord = geometry->nodes->GetCoord(iPoint);
+      passivedouble val = 0.0;
+
+      switch (kind) {
+        case EXTRACT_KIND::BOX: {
+          bool inside = true;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const passivedouble x = SU2_TYPE::GetValue(coord[iDim]);
+            inside &= (x >= SU2_TYPE::GetValue(box[iDim])) && (x <= SU2_TYPE::GetValue(box[3+iDim]));
+          }
+          if (inside) return true;
+          continue;
+        }
+        case EXTRACT_KIND::SLICE:
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            val += SU2_TYPE::GetValue((coord[iDim] - plane[iDim]) * plane[3+iDim]);
+          break;
+        case EXTRACT_KIND::ISOSURFACE:
+          val = isoValues[iPoint];
+          break;
+      }
+      minVal = std::min(minVal, val);
+      maxVal = std::max(maxVal, val);
+    }
+    return (minVal <= 0.0) && (maxVal >= 0.0);
+  };
+
+  vector<unsigned long> extractedElems;
+  vector<bool> isCandidate(nPoint, false);
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const auto* elem = geometry->elem[iElem];
+    if (!isValidType(elem->GetVTK_Type())) continue;
+
+    bool halo = false;
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++)
+      halo |= volumeSorter->GetHalo(elem->GetNode(iNode));
+
+    if (!halo && isSelected(iElem)) {
+      extractedElems.push_back(iElem);
+      for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++)
+        isCandidate[elem->GetNode(iNode)] = true;
+    }
+    else if (halo) {
+      /*--- Another rank may select this element, it will need our domain points. ---*/
+      for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++)
+        if (elem->GetNode(iNode) < nPointDomain) isCandidate[elem->GetNode(iNode)] = true;
+    }
+  }
+
+  /*--- The points of the selected elements are marked on the ranks that own them in a linear
+   *    partitioning of the global indices, these ranks then number the marked points contiguously. ---*/
+
+  CLinearPartitioner pointPartitioner(geometry->GetGlobal_nPointDomain(), 0);
+  vector<unsigned long> newIndex(pointPartitioner.GetSizeOnRank(rank), NOT_EXTRACTED);
+
+  vector<unsigned long> globalIDs;
+  vector<bool> added(nPoint, false);
+  for (auto iElem : extractedElems) {
+    const auto* elem = geometry->elem[iElem];
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+      const auto iPoint = elem->GetNode(iNode);
+      if (added[iPoint]) continue;
+      added[iPoint] = true;
+      globalIDs.push_back(geometry->nodes->GetGlobalIndex(iPoint));
+    }
+  }
+
+  QueryOwners(globalIDs, pointPartitioner, [&](unsigned long i) { newIndex[i] = 0; return 0ul; }, false);
+
+  unsigned long nMarked = 0;
+  for (auto& idx : newIndex) {
+    if (idx != NOT_EXTRACTED) idx = nMarked++;
+  }
+
+  vector<unsigned long> nMarkedRank(size);
+  SU2_MPI::Allgather(&nMarked, 1, MPI_UNSIGNED_LONG, nMarkedRank.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  unsigned long offset = 0;
+  nGlobalPointBeforeSort = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) offset += nMarkedRank[iRank];
+    nGlobalPointBeforeSort += nMarkedRank[iRank];
+  }
+  for (auto& idx : newIndex) {
+    if (idx != NOT_EXTRACTED) idx += offset;
+  }
+
+  /*--- Retrieve the new indices of the candidate points (element nodes and domain points that
+   *    other ranks may need), the global index is NOT_EXTRACTED for the points that are not written. ---*/
+
+  vector<unsigned long> candidates;
+  globalIDs.clear();
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (!isCandidate[iPoint]) continue;
+    candidates.push_back(iPoint);
+    globalIDs.push_back(geometry->nodes->GetGlobalIndex(iPoint));
+  }
+
+  const auto candidateIndex = QueryOwners(globalIDs, pointPartitioner,
+                                          [&](unsigned long i) { return newIndex[i]; }, true);
+
+  vector<unsigned long> localIndex(nPoint, NOT_EXTRACTED);
+  vector<unsigned long> globalID;
+
+  for (unsigned long i = 0; i < candidates.size(); i++) {
+    const auto iPoint = candidates[i];
+    localIndex[iPoint] = candidateIndex[i];
+    if (iPoint < nPointDomain && candidateIndex[i] != NOT_EXTRACTED) {
+      extractedPoints.push_back(iPoint);
+      globalID.push_back(candidateIndex[i]);
+    }
+  }
+  nLocalPointsBeforeSort = extractedPoints.size();
+
+  /*--- Create the linear partitioner of the extracted points and prepare the send buffers. ---*/
+
+  linearPartitioner.Initialize(nGlobalPointBeforeSort, 0);
+
+  PrepareSendBuffers(globalID);
+
+  /*--- The elements are written by the rank that selected them (no sorting), the connectivity
+   *    refers to the new indices, we add 1 for the visualization packages. ---*/
+
+  for (auto type : elemTypes) {
+    unsigned long nElemType = 0;
+    unsigned short nNodes = 0;
+    for (auto iElem : extractedElems) {
+      if (geometry->elem[iElem]->GetVTK_Type() != type) continue;
+      nNodes = geometry->elem[iElem]->GetnNodes();
+      ++nElemType;
+    }
+
+    int* conn = nullptr;
+    if (nElemType > 0) {
+      conn = new int[nElemType * nNodes];
+      unsigned long count = 0;
+      for (auto iElem : extractedElems) {
+        const auto* elem = geometry->elem[iElem];
+        if (elem->GetVTK_Type() != type) continue;
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          conn[count++] = static_cast<int>(localIndex[elem->GetNode(iNode)]) + 1;
+      }
+    }
+    nElemPerType[TypeMap.at(type)] = nElemType;
+
+    switch (type) {
+      case TRIANGLE: Conn_Tria_Par = conn; break;
+      case QUADRILATERAL: Conn_Quad_Par = conn; break;
+      case TETRAHEDRON: Conn_Tetr_Par = conn; break;
+      case HEXAHEDRON: Conn_Hexa_Par = conn; break;
+      case PRISM: Conn_Pris_Par = conn; break;
+      case PYRAMID: Conn_Pyra_Par = conn; break;
+      default: break;
+    }
+  }
+
+  SetTotalElements();
+
+  connectivitySorted = true;
+
+}
+
+void CExtractFVMDataSorter::SortOutputData() {
+
+  for (unsigned long iPoint = 0; iPoint < nLocalPointsBeforeSort; iPoint++) {
+    for (unsigned short iField = 0; iField < GlobalField_Counter; iField++) {
+      connSend[Index[iPoint] + iField] = volumeSorter->GetUnsortedData(extractedPoints[iPoint], volumeFields[iField]);
+    }
+  }
+
+  CParallelDataSorter::SortOutputData();
+
+}
+
+vector<unsigned long> CExtractFVMDataSorter::QueryOwners(const vector<unsigned long>& globalIDs,
+                                                         const CLinearPartitioner& partitioner,
+                                                         const std::function<unsigned long(unsigned long)>& owner,
+                                                         bool reply) const {
+
+  /*--- Bucket the indices by owning rank. ---*/
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  vector<int> ownerRank(globalIDs.size());
+  for (unsigned long i = 0; i < globalIDs.size(); i++) {
+    ownerRank[i] = partitioner.GetRankContainingIndex(globalIDs[i]);
+    nSend[ownerRank[i]]++;
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> sendBuf(sendDispl[size]), position(globalIDs.size());
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
+  for (unsigned long i = 0; i < globalIDs.size(); i++) {
+    position[i] = counter[ownerRank[i]]++;
+    sendBuf[position[i]] = globalIDs[i];
+  }
+
+  vector<unsigned long> recvBuf(recvDispl[size]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- Process the requests, the answers overwrite the received indices. ---*/
+
+  const auto firstIndex = partitioner.GetFirstIndexOnRank(rank);
+  for (auto& id : recvBuf) id = owner(id - firstIndex);
+
+  if (!reply) return {};
+
+  SU2_MPI::Alltoallv(recvBuf.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     sendBuf.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<unsigned long> answer(globalIDs.size());
+  for (unsigned long i = 0; i < globalIDs.size(); i++) answer[i] = sendBuf[position[i]];
+
+  return answer;
+}
@@ -25,13 +25,15 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <memory>
 #include <utility>
 
 #include "../../../include/output/filewriter/CFileWriter.hpp"
 
 CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(std::move(valFileExt)),
-  dataSorter(valDataSorter){
+  dataSorter(valDataSorter),
+  ioComm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -42,7 +44,8 @@ CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
 }
 
 CFileWriter::CFileWriter(string valFileExt):
-  fileExt(std::move(valFileExt)){
+  fileExt(std::move(valFileExt)),
+  ioComm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -54,9 +57,38 @@ CFileWriter::CFileWriter(string valFileExt):
 
 CFileWriter::~CFileWriter()= default;
 
+void CFileWriter::RunOrDefer(function<void()> op){
+  if (deferredIO) deferredOps.push_back(std::move(op));
+  else op();
+}
+
+void CFileWriter::SetDeferredIO(SU2_MPI::Comm comm){
+  ioComm = comm;
+  deferredIO = true;
+}
+
+void CFileWriter::FlushDeferredIO(){
+
+  /*--- The recorded operations call the same routines, which now execute them. ---*/
+
+  deferredIO = false;
+  for (auto& op : deferredOps) op();
+  deferredOps.clear();
+}
+
 bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes,
                                         unsigned long totalSizeInBytes, unsigned long offsetInBytes){
 
+  if (deferredIO) {
+    const auto* bytes = static_cast<const char*>(data);
+    const auto copy = make_shared<vector<char> >(bytes, bytes + sizeInBytes);
+    deferredOps.push_back([=]() {
+      if (!WriteMPIBinaryDataAll(copy->data(), sizeInBytes, totalSizeInBytes, offsetInBytes))
+        SU2_MPI::Error("Writing data failed", CURRENT_FUNCTION);
+    });
+    return true;
+  }
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -111,6 +143,18 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor){
 
+  if (deferredIO) {
+    /*--- Only the writing processor needs the data, but all keep track of the displacement. ---*/
+    const auto* bytes = static_cast<const char*>(data);
+    const auto copy = make_shared<vector<char> >();
+    if (rank == processor) copy->assign(bytes, bytes + sizeInBytes);
+    deferredOps.push_back([=]() {
+      if (!WriteMPIBinaryData(copy->data(), sizeInBytes, processor))
+        SU2_MPI::Error("Writing data failed", CURRENT_FUNCTION);
+    });
+    return true;
+  }
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -155,6 +199,14 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
 
 bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
+  if (deferredIO) {
+    deferredOps.push_back([=]() {
+      if (!WriteMPIString(str, processor))
+        SU2_MPI::Error("Writing string failed", CURRENT_FUNCTION);
+    });
+    return true;
+  }
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -200,6 +252,11 @@ bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
 bool CFileWriter::OpenMPIFile(string val_filename){
 
+  if (deferredIO) {
+    deferredOps.push_back([=]() { OpenMPIFile(val_filename); });
+    return true;
+  }
+
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
   val_filename.append(fileExt);
 
@@ -212,14 +269,14 @@ bool CFileWriter::OpenMPIFile(string val_filename){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+  ierr = MPI_File_open(ioComm, val_filename.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+    ierr = MPI_File_open(ioComm, val_filename.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -248,6 +305,11 @@ bool CFileWriter::OpenMPIFile(string val_filename){
 
 bool CFileWriter::CloseMPIFile(){
 
+  if (deferredIO) {
+    deferredOps.push_back([=]() { CloseMPIFile(); });
+    return true;
+  }
+
 #ifdef HAVE_MPI
   /*--- All ranks close the file after writing. ---*/
 
@@ -260,7 +322,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+                     MPI_DOUBLE, MPI_SUM, ioComm);
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -54,7 +54,7 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
    and number of points (DoFs). ---*/
 
   int var_buf_size = 5;
-  int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
+  int var_buf[5] = {SU2_RESTART_MAGIC, nVar, (int)nPoint_Global, 0, 0};
 
   /*--- Open the file using MPI I/O ---*/
 
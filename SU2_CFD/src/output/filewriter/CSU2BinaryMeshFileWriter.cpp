@@ -0,0 +1,228 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class for SU2 native binary mesh format.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+#include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(CParallelDataSorter *valDataSorter,
+                                                   unsigned short valiZone, unsigned short valnZone) :
+   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+
+unsigned long CSU2BinaryMeshFileWriter::ReadBoundaryFile(vector<char>& markers) const {
+
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
+
+  ifstream input_file;
+  input_file.open(str);
+
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  auto append = [&markers](const void* data, size_t sizeInBytes) {
+    const auto* bytes = static_cast<const char*>(data);
+    markers.insert(markers.end(), bytes, bytes + sizeInBytes);
+  };
+
+  unsigned long nMarker = 0;
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    auto position = text_line.find("NMARK=",0);
+
+    if (position == string::npos) continue;
+
+    text_line.erase(0,6);
+    nMarker = atoi(text_line.c_str());
+
+    for (auto iMarker = 0ul; iMarker < nMarker; iMarker++) {
+
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      for (int iChar = 0; iChar < 20; iChar++) {
+        position = text_line.find(' ', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\r', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\n', 0);
+        if (position != string::npos) text_line.erase(position,1);
+      }
+      const string Marker_Tag = text_line;
+
+      getline(input_file, text_line);
+      text_line.erase(0,13);
+      const int64_t nElem_Bound = atoi(text_line.c_str());
+
+      /*--- SEND_TO line, not used by the binary format. ---*/
+      getline(input_file, text_line);
+
+      const int64_t nameLength = Marker_Tag.size();
+      append(&nElem_Bound, sizeof(int64_t));
+      append(&nameLength, sizeof(int64_t));
+      append(Marker_Tag.data(), nameLength);
+
+      for (auto iElem_Bound = 0l; iElem_Bound < nElem_Bound; iElem_Bound++) {
+
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+
+        unsigned short VTK_Type;
+        bound_line >> VTK_Type;
+
+        if (VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) {
+          SU2_MPI::Error("The SU2 binary mesh format only supports line, triangle, and quadrilateral boundary elements.",
+                         CURRENT_FUNCTION);
+        }
+
+        const int64_t type = VTK_Type;
+        append(&type, sizeof(int64_t));
+
+        for (auto iNode = 0u; iNode < nPointsOfElementType(VTK_Type); ++iNode) {
+          int64_t node;
+          bound_line >> node;
+          append(&node, sizeof(int64_t));
+        }
+      }
+    }
+    break;
+  }
+  return nMarker;
+}
+
+void CSU2BinaryMeshFileWriter::WriteData(string val_filename) {
+
+  using namespace SU2BinaryMesh;
+
+  /*--- Each file contains one zone. ---*/
+
+  if (nZone > 1) val_filename += "_" + PrintingToolbox::to_string(iZone);
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+
+  const GEO_TYPE elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+
+  /*--- The elements are written in order of rank, i.e. in the same order as the ASCII mesh writer.
+   Compute the local sizes, and from those the global offsets (64 bit, the cumulative counts of the
+   data sorter are int and overflow for very large meshes). ---*/
+
+  unsigned long localSizes[2] = {0, 0};
+  for (auto type : elemTypes) {
+    localSizes[0] += dataSorter->GetnElem(type);
+    localSizes[1] += dataSorter->GetnElem(type) * (nPointsOfElementType(type) + 1);
+  }
+  vector<unsigned long> allSizes(2 * size);
+  SU2_MPI::Allgather(localSizes, 2, MPI_UNSIGNED_LONG, allSizes.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  unsigned long nElemGlobal = 0, nConnGlobal = 0, elemOffset = 0, connOffset = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank == rank) {
+      elemOffset = nElemGlobal;
+      connOffset = nConnGlobal;
+    }
+    nElemGlobal += allSizes[2 * iRank];
+    nConnGlobal += allSizes[2 * iRank + 1];
+  }
+
+  /*--- The master prepares the markers from the boundary file, the other ranks need the
+   sizes to keep track of the file displacement. ---*/
+
+  vector<char> markers;
+  unsigned long markerSizes[2] = {0, 0};
+
+  if (rank == MASTER_NODE) {
+    markerSizes[0] = ReadBoundaryFile(markers);
+    markerSizes[1] = markers.size();
+  }
+  SU2_MPI::Bcast(markerSizes, 2, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- Header. ---*/
+
+  int64_t header[HEADER_SIZE] = {0};
+  header[NDIME] = nDim;
+  header[NPOIN] = nPointGlobal;
+  header[NELEM] = nElemGlobal;
+  header[NMARK] = markerSizes[0];
+  header[POINTS_OFFSET] = magicSize + sizeof(header);
+  header[ELEM_INDEX_OFFSET] = header[POINTS_OFFSET] + nPointGlobal * nDim * sizeof(double);
+  header[ELEM_CONN_OFFSET] = header[ELEM_INDEX_OFFSET] + (nElemGlobal + 1) * sizeof(int64_t);
+  header[MARKERS_OFFSET] = header[ELEM_CONN_OFFSET] + nConnGlobal * sizeof(int64_t);
+  header[MARKERS_SIZE] = markerSizes[1];
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(magic, magicSize, MASTER_NODE);
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Points, the coordinates are the first fields of the sorted data. ---*/
+
+  vector<double> coords(nPoint * nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coords[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  WriteMPIBinaryDataAll(coords.data(), coords.size() * sizeof(double), nPointGlobal * nDim * sizeof(double),
+                        dataSorter->GetnPointCumulative(rank) * nDim * sizeof(double));
+  vector<double>().swap(coords);
+
+  /*--- Element index and connectivity (0-based point indices). ---*/
+
+  vector<int64_t> elemIndex, conn;
+  elemIndex.reserve(localSizes[0]);
+  conn.reserve(localSizes[1]);
+
+  for (auto type : elemTypes) {
+    const auto nPointsElem = nPointsOfElementType(type);
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elemIndex.push_back(connOffset + conn.size());
+      conn.push_back(type);
+      for (auto iNode = 0u; iNode < nPointsElem; ++iNode)
+        conn.push_back(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1);
+    }
+  }
+
+  WriteMPIBinaryDataAll(elemIndex.data(), elemIndex.size() * sizeof(int64_t), nElemGlobal * sizeof(int64_t),
+                        elemOffset * sizeof(int64_t));
+
+  const int64_t indexEnd = nConnGlobal;
+  WriteMPIBinaryData(&indexEnd, sizeof(int64_t), MASTER_NODE);
+
+  WriteMPIBinaryDataAll(conn.data(), conn.size() * sizeof(int64_t), nConnGlobal * sizeof(int64_t),
+                        connOffset * sizeof(int64_t));
+
+  /*--- Markers. ---*/
+
+  WriteMPIBinaryData(markers.data(), markerSizes[1], MASTER_NODE);
+
+  CloseMPIFile();
+
+}
@@ -0,0 +1,125 @@
+/*!
+ * \file CSU2CompressedFileWriter.cpp
+ * \brief Filewriter class for the compressed SU2 binary (restart) format.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2CompressedFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+const string CSU2CompressedFileWriter::fileExt = ".dat";
+constexpr unsigned long CSU2CompressedFileWriter::blockSize;
+
+CSU2CompressedFileWriter::CSU2CompressedFileWriter(CParallelDataSorter *valDataSorter, vector<int> valDroppedBits) :
+  CFileWriter(valDataSorter, fileExt), droppedBits(std::move(valDroppedBits)) {}
+
+void CSU2CompressedFileWriter::WriteData(string val_filename){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const int nVar = fieldNames.size();
+  const unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  const unsigned long firstPoint = dataSorter->GetnPointCumulative(rank);
+
+  if (droppedBits.size() != fieldNames.size())
+    SU2_MPI::Error("The number of dropped bits does not match the number of fields.", CURRENT_FUNCTION);
+
+  /*--- Compress the local points in blocks, keeping track of the first point and size of each. ---*/
+
+  const unsigned long nBlockLocal = (nParallel_Poin + blockSize - 1) / blockSize;
+  vector<unsigned long> blockPoint(nBlockLocal), blockBytes(nBlockLocal);
+  vector<uint8_t> buffer;
+  buffer.reserve(nParallel_Poin * nVar * sizeof(passivedouble) / 2);
+
+  for (auto iBlock = 0ul; iBlock < nBlockLocal; ++iBlock) {
+    const auto iPoint = iBlock * blockSize;
+    const auto nPointBlock = min(blockSize, nParallel_Poin - iPoint);
+    const auto start = buffer.size();
+    CompressionToolbox::CompressBlock(dataSorter->GetData() + iPoint * nVar, nPointBlock, nVar,
+                                      droppedBits.data(), buffer);
+    blockPoint[iBlock] = firstPoint + iPoint;
+    blockBytes[iBlock] = buffer.size() - start;
+  }
+
+  /*--- Gather the block information to build the global block table, ranks are ordered by points. ---*/
+
+  vector<unsigned long> rankBlocks(size), rankBytes(size);
+  unsigned long nBlockLoc = nBlockLocal, nBytesLoc = buffer.size();
+  SU2_MPI::Allgather(&nBlockLoc, 1, MPI_UNSIGNED_LONG, rankBlocks.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&nBytesLoc, 1, MPI_UNSIGNED_LONG, rankBytes.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<int> counts(size), displs(size);
+  unsigned long nBlock_Global = 0, nBytes_Global = 0, offsetInBytes = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    counts[iRank] = rankBlocks[iRank];
+    displs[iRank] = nBlock_Global;
+    nBlock_Global += rankBlocks[iRank];
+    if (iRank < rank) offsetInBytes += rankBytes[iRank];
+    nBytes_Global += rankBytes[iRank];
+  }
+
+  vector<unsigned long> allPoint(nBlock_Global), allBytes(nBlock_Global);
+  SU2_MPI::Allgatherv(blockPoint.data(), nBlockLocal, MPI_UNSIGNED_LONG, allPoint.data(), counts.data(),
+                      displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  SU2_MPI::Allgatherv(blockBytes.data(), nBlockLocal, MPI_UNSIGNED_LONG, allBytes.data(), counts.data(),
+                      displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- The table has the first point and the byte offset (relative to the start of the data) of each
+   *    block, plus one entry for the end. ---*/
+
+  vector<uint64_t> blockTable(2 * (nBlock_Global + 1));
+  uint64_t offset = 0;
+  for (auto iBlock = 0ul; iBlock < nBlock_Global; ++iBlock) {
+    blockTable[iBlock] = allPoint[iBlock];
+    blockTable[nBlock_Global + 1 + iBlock] = offset;
+    offset += allBytes[iBlock];
+  }
+  blockTable[nBlock_Global] = nPoint_Global;
+  blockTable[2 * nBlock_Global + 1] = offset;
+
+  /*--- The header matches the uncompressed format, with the number of blocks as the fourth int. ---*/
+
+  int var_buf[5] = {SU2_COMPRESSED_RESTART_MAGIC, nVar, (int)nPoint_Global, (int)nBlock_Global, 0};
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(var_buf, 5*sizeof(int), MASTER_NODE);
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (int iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  WriteMPIBinaryData(droppedBits.data(), nVar*sizeof(int), MASTER_NODE);
+
+  WriteMPIBinaryData(blockTable.data(), blockTable.size()*sizeof(uint64_t), MASTER_NODE);
+
+  /*--- Collectively write the compressed blocks. ---*/
+
+  WriteMPIBinaryDataAll(buffer.data(), buffer.size(), nBytes_Global, offsetInBytes);
+
+  CloseMPIFile();
+
+}
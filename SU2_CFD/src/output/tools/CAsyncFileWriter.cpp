@@ -0,0 +1,101 @@
+/*!
+ * \file CAsyncFileWriter.cpp
+ * \brief Background writing of output files.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CAsyncFileWriter.hpp"
+#include "../../../include/output/filewriter/CFileWriter.hpp"
+
+CAsyncFileWriter::CAsyncFileWriter() {
+#ifdef HAVE_MPI
+  MPI_Comm_dup(SU2_MPI::GetComm(), &comm);
+#else
+  comm = SU2_MPI::GetComm();
+#endif
+  worker = std::thread(&CAsyncFileWriter::Work, this);
+}
+
+CAsyncFileWriter::~CAsyncFileWriter() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stop = true;
+  }
+  cv.notify_all();
+  worker.join();
+#ifdef HAVE_MPI
+  MPI_Comm_free(&comm);
+#endif
+}
+
+bool CAsyncFileWriter::IsSupported() {
+#if defined CODI_REVERSE_TYPE
+  /*--- The file writers also communicate su2double, which must not happen outside the main thread. ---*/
+  return false;
+#elif defined HAVE_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
+void CAsyncFileWriter::Prepare(CFileWriter* writer) const { writer->SetDeferredIO(comm); }
+
+void CAsyncFileWriter::Push(CFileWriter* writer) {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    queue.push_back(writer);
+  }
+  cv.notify_all();
+}
+
+void CAsyncFileWriter::Wait() {
+  std::unique_lock<std::mutex> lock(mtx);
+  cv.wait(lock, [this]() { return queue.empty(); });
+}
+
+void CAsyncFileWriter::Work() {
+  while (true) {
+    CFileWriter* writer = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [this]() { return stop || !queue.empty(); });
+      if (queue.empty()) return;
+      writer = queue.front();
+    }
+
+    /*--- The writer stays in the queue until it is done, for Wait to work. ---*/
+
+    writer->FlushDeferredIO();
+    delete writer;
+
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      queue.pop_front();
+    }
+    cv.notify_all();
+  }
+}
@@ -1572,8 +1572,10 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   ompMasterAssignBarrier(ErrorCounter, 0);
 
+  AD::StartTapePhase(SolverName, "primitive variables");
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
+  AD::EndTapePhase();
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
   { /*--- Ops that are not OpenMP parallel go in this block. ---*/
@@ -1759,7 +1761,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool low_mach_corr = config->Low_Mach_Correction();
 
   /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  if (CNumericsSIMD::SupportsUpwindScheme(*config, iMesh) && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
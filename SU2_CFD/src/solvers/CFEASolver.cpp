@@ -3088,16 +3088,15 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
        offset in the buffer of data from the restart file and load it. ---*/
 
       const auto index = counter*Restart_Vars[1] + skipVars;
-      const passivedouble* Sol = &Restart_Data[index];
 
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
+        nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
         if (dynamic) {
-          nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+          nodes->SetSolution_Vel(iPoint_Local, iVar, Restart_Data[index+iVar+nVar]);
+          nodes->SetSolution_Accel(iPoint_Local, iVar, Restart_Data[index+iVar+2*nVar]);
         }
         if (fluid_structure && discrete_adjoint){
-          nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
+          nodes->SetSolution_Old(iPoint_Local, iVar, Restart_Data[index+iVar]);
         }
       }
 
@@ -954,8 +954,10 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
 
   ompMasterAssignBarrier(ErrorCounter, 0);
 
+  AD::StartTapePhase(SolverName, "primitive variables");
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
+  AD::EndTapePhase();
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
     BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
@@ -46,6 +46,8 @@
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CMemoryMappedFile.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
@@ -2117,7 +2119,9 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, const CConfig *config
   const auto comm = reconstruction? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_SOL_GG_R : PERIODIC_SOL_GG;
 
+  AD::StartTapePhase(SolverName, "gradients");
   computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, solution, 0, nVar, gradient);
+  AD::EndTapePhase();
 }
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config, bool reconstruction) {
@@ -2140,7 +2144,9 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config
   auto& gradient = reconstruction? base_nodes->GetGradient_Reconstruction() : base_nodes->GetGradient();
   const auto comm = reconstruction? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
 
+  AD::StartTapePhase(SolverName, "gradients");
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted, solution, 0, nVar, gradient, rmatrix);
+  AD::EndTapePhase();
 }
 
 void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config) {
@@ -2251,8 +2257,10 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, const CConfig *config) {
   auto& solMax = base_nodes->GetSolution_Max();
   auto& limiter = base_nodes->GetLimiter();
 
+  AD::StartTapePhase(SolverName, "limiters");
   computeLimiters(kindLimiter, this, SOLUTION_LIMITER, PERIODIC_LIM_SOL_1, PERIODIC_LIM_SOL_2,
                   *geometry, *config, 0, nVar, solution, gradient, solMin, solMax, limiter);
+  AD::EndTapePhase();
 }
 
 void CSolver::Gauss_Elimination(su2double** A, su2double* rhs, unsigned short nVar) {
@@ -2876,7 +2884,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
       /*--- Store the solution (starting with node coordinates) --*/
 
       for (iVar = 0; iVar < Restart_Vars[1]; iVar++)
-        Restart_Data[counter*Restart_Vars[1] + iVar] = SU2_TYPE::GetValue(PrintingToolbox::stod(point_line[iVar+1]));
+        Restart_Data.data()[counter*Restart_Vars[1] + iVar] = SU2_TYPE::GetValue(PrintingToolbox::stod(point_line[iVar+1]));
 
       /*--- Increment our local point counter. ---*/
 
@@ -2896,6 +2904,33 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   char str_buf[CGNS_STRING_SIZE], fname[100];
   val_filename += ".dat";
   strcpy(fname, val_filename.c_str());
+
+  /*--- Compressed restart files are identified by their magic number and read separately. ---*/
+
+  int magic_number = 0;
+  if (rank == MASTER_NODE) {
+    FILE *fhm = fopen(fname, "rb");
+    if (fhm) {
+      if (fread(&magic_number, sizeof(int), 1, fhm) != 1) magic_number = 0;
+      fclose(fhm);
+    }
+  }
+  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (magic_number == SU2_COMPRESSED_RESTART_MAGIC) {
+    Read_SU2_Restart_Compressed(geometry, config, val_filename);
+
+    if (static_cast<unsigned long>(Restart_Vars[2]) != geometry->GetGlobal_nPointDomain() &&
+        config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+      InterpolateRestartData(geometry, config);
+    }
+    return;
+  }
+
+  /*--- Memory mapped input, the values are used in place. ---*/
+
+  if (config->GetRestart_Mmap() && Read_SU2_Restart_Mapped(geometry, config, val_filename)) return;
+
   const int nRestart_Vars = 5;
   Restart_Vars.resize(nRestart_Vars);
   fields.clear();
@@ -3123,6 +3158,282 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   }
 }
 
+void CSolver::Read_SU2_Restart_Compressed(CGeometry *geometry, const CConfig *config, const string& val_filename) {
+
+  const int nRestart_Vars = 5;
+  Restart_Vars.resize(nRestart_Vars);
+  fields.clear();
+
+  vector<char> names;
+  vector<int> droppedBits;
+  vector<uint64_t> blockTable;
+
+  /*--- Sizes of the header sections, all read by the master rank. ---*/
+
+  auto ReadHeaderSizes = [&]() {
+    if (Restart_Vars[0] != SU2_COMPRESSED_RESTART_MAGIC) {
+      SU2_MPI::Error(string("File ") + val_filename + string(" is not a compressed SU2 restart file."),
+                     CURRENT_FUNCTION);
+    }
+    names.resize(Restart_Vars[1] * CGNS_STRING_SIZE);
+    droppedBits.resize(Restart_Vars[1]);
+    blockTable.resize(2 * (Restart_Vars[3] + 1ul));
+  };
+
+  auto DecompressError = [&]() {
+    SU2_MPI::Error(string("Corrupt block in compressed SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+  };
+
+#ifndef HAVE_MPI
+
+  /*--- Serial binary input. ---*/
+
+  FILE *fhw = fopen(val_filename.c_str(), "rb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  auto ReadOrError = [&](void* ptr, size_t size, size_t count) {
+    if (fread(ptr, size, count, fhw) != count) SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  };
+
+  ReadOrError(Restart_Vars.data(), sizeof(int), nRestart_Vars);
+  ReadHeaderSizes();
+  ReadOrError(names.data(), sizeof(char), names.size());
+  ReadOrError(droppedBits.data(), sizeof(int), droppedBits.size());
+  ReadOrError(blockTable.data(), sizeof(uint64_t), blockTable.size());
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const unsigned long nBlock = Restart_Vars[3];
+  const uint64_t* blockPoint = blockTable.data();
+  const uint64_t* blockOffset = blockTable.data() + nBlock + 1;
+
+  fields.push_back("Point_ID");
+  for (auto iVar = 0ul; iVar < nFields; iVar++) {
+    fields.push_back(string(&names[iVar * CGNS_STRING_SIZE]));
+  }
+
+  /*--- Read and decompress all blocks. ---*/
+
+  vector<uint8_t> buffer(blockOffset[nBlock]);
+  ReadOrError(buffer.data(), sizeof(uint8_t), buffer.size());
+  fclose(fhw);
+
+  Restart_Data.resize(nFields*nPointFile);
+
+  for (auto iBlock = 0ul; iBlock < nBlock; ++iBlock) {
+    if (!CompressionToolbox::DecompressBlock(buffer.data() + blockOffset[iBlock],
+                                             blockOffset[iBlock + 1] - blockOffset[iBlock],
+                                             blockPoint[iBlock + 1] - blockPoint[iBlock], nFields, droppedBits.data(),
+                                             Restart_Data.data() + blockPoint[iBlock] * nFields)) {
+      DecompressError();
+    }
+  }
+
+#else
+
+  /*--- Parallel binary input using MPI I/O. ---*/
+
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype filetype;
+
+  int ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE)
+    MPI_File_read(fhw, Restart_Vars.data(), nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
+
+  SU2_MPI::Bcast(Restart_Vars.data(), nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  ReadHeaderSizes();
+
+  /*--- The master reads the rest of the header and broadcasts it. ---*/
+
+  MPI_Offset disp = nRestart_Vars*sizeof(int);
+
+  if (rank == MASTER_NODE) {
+    MPI_File_read_at(fhw, disp, names.data(), names.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_read_at(fhw, disp + names.size(), droppedBits.data(), droppedBits.size(), MPI_INT, MPI_STATUS_IGNORE);
+    MPI_File_read_at(fhw, disp + names.size() + droppedBits.size()*sizeof(int), blockTable.data(),
+                     blockTable.size()*sizeof(uint64_t), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+  disp += names.size() + droppedBits.size()*sizeof(int) + blockTable.size()*sizeof(uint64_t);
+
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(droppedBits.data(), droppedBits.size(), MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(blockTable.data(), blockTable.size()*sizeof(uint64_t), MPI_BYTE, MASTER_NODE, SU2_MPI::GetComm());
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const unsigned long nBlock = Restart_Vars[3];
+  const uint64_t* blockPoint = blockTable.data();
+  const uint64_t* blockOffset = blockTable.data() + nBlock + 1;
+
+  fields.emplace_back("Point_ID");
+  for (auto iVar = 0ul; iVar < nFields; iVar++) {
+    fields.emplace_back("\"" + string(&names[iVar * CGNS_STRING_SIZE]) + "\"");
+  }
+
+  /*--- Global indices (sorted) of the points this rank needs, as in Read_SU2_Restart_Binary. ---*/
+
+  vector<unsigned long> points;
+
+  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
+      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
+    points.reserve(geometry->GetnPointDomain());
+    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) points.push_back(iPoint_Global);
+    }
+  }
+  else {
+    const auto partitioner = CLinearPartitioner(nPointFile,0);
+    points.resize(partitioner.GetSizeOnRank(rank));
+    iota(points.begin(), points.end(), partitioner.GetFirstIndexOnRank(rank));
+  }
+
+  /*--- Blocks that contain those points, adjacent blocks are read as one chunk. ---*/
+
+  vector<unsigned long> blocks;
+  vector<int> blocklen;
+  vector<MPI_Aint> displace;
+  unsigned long nBytes = 0;
+
+  for (auto iPoint = 0ul, iBlock = 0ul; iPoint < points.size(); ++iPoint) {
+    while (iBlock < nBlock && blockPoint[iBlock + 1] <= points[iPoint]) ++iBlock;
+    if (iBlock == nBlock) SU2_MPI::Error("Point not found in compressed restart file.", CURRENT_FUNCTION);
+    if (!blocks.empty() && blocks.back() == iBlock) continue;
+
+    blocks.push_back(iBlock);
+    const auto begin = blockOffset[iBlock];
+    const auto size = blockOffset[iBlock + 1] - begin;
+
+    if (!displace.empty() && uint64_t(displace.back() + blocklen.back()) == begin &&
+        blocklen.back() + size < static_cast<uint64_t>(numeric_limits<int>::max())) {
+      blocklen.back() += size;
+    } else {
+      displace.push_back(begin);
+      blocklen.push_back(size);
+    }
+    nBytes += size;
+  }
+
+  MPI_Type_create_hindexed(blocklen.size(), blocklen.data(), displace.data(), MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, disp, MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  vector<uint8_t> buffer(nBytes);
+
+  MPI_File_read_all(fhw, buffer.data(), nBytes, MPI_BYTE, &status);
+
+  MPI_File_close(&fhw);
+
+  MPI_Type_free(&filetype);
+
+  /*--- Decompress the blocks and keep the points that are needed. ---*/
+
+  Restart_Data.resize(nFields*points.size());
+  vector<passivedouble> blockData;
+  unsigned long pos = 0, iPoint = 0;
+
+  for (const auto iBlock : blocks) {
+    const auto firstPoint = blockPoint[iBlock];
+    const auto nPointBlock = blockPoint[iBlock + 1] - firstPoint;
+    const auto size = blockOffset[iBlock + 1] - blockOffset[iBlock];
+
+    blockData.resize(nPointBlock*nFields);
+    if (!CompressionToolbox::DecompressBlock(buffer.data() + pos, size, nPointBlock, nFields,
+                                             droppedBits.data(), blockData.data())) {
+      DecompressError();
+    }
+    pos += size;
+
+    for (; iPoint < points.size() && points[iPoint] < firstPoint + nPointBlock; ++iPoint) {
+      const auto row = points[iPoint] - firstPoint;
+      for (auto iVar = 0ul; iVar < nFields; ++iVar)
+        Restart_Data.data()[iPoint*nFields + iVar] = blockData[row*nFields + iVar];
+    }
+  }
+
+#endif
+
+}
+
+bool CSolver::Read_SU2_Restart_Mapped(CGeometry *geometry, const CConfig *config, const string& val_filename) {
+
+  const int nRestart_Vars = 5;
+
+  /*--- All ranks map the file, the pages are loaded on demand and shared by the ranks of a node. ---*/
+
+  CMemoryMappedFile file;
+  int mapped = file.Open(val_filename) &&
+               file.Size() >= nRestart_Vars*sizeof(int);
+  int allMapped = 0;
+  SU2_MPI::Allreduce(&mapped, &allMapped, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (!allMapped) {
+    if (rank == MASTER_NODE)
+      cout << "WARNING: Could not map the restart file " << val_filename << " into memory, reading it instead." << endl;
+    return false;
+  }
+
+  Restart_Vars.resize(nRestart_Vars);
+  memcpy(Restart_Vars.data(), file.Data(), nRestart_Vars*sizeof(int));
+
+  /*--- Other files are handled (or rejected) by Read_SU2_Restart_Binary. Interpolation needs the
+   *    linear partition of the file (see InterpolateRestartData), the file is then read normally. ---*/
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+
+  if (Restart_Vars[0] != SU2_RESTART_MAGIC) return false;
+
+  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
+      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) return false;
+
+  const size_t offset = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+
+  if (file.Size() < offset + nFields*nPointFile*sizeof(passivedouble)) {
+    SU2_MPI::Error(string("The SU2 restart file ") + val_filename + string(" is truncated."), CURRENT_FUNCTION);
+  }
+
+  /*--- Variable names, see Read_SU2_Restart_Binary. ---*/
+
+  fields.clear();
+  fields.emplace_back("Point_ID");
+  for (auto iVar = 0ul; iVar < nFields; iVar++) {
+    const string name(file.Data() + nRestart_Vars*sizeof(int) + iVar*CGNS_STRING_SIZE);
+#ifdef HAVE_MPI
+    fields.emplace_back("\"" + name + "\"");
+#else
+    fields.emplace_back(name);
+#endif
+  }
+
+  /*--- Rows of the local points, in ascending order of global index as if they had been read.
+   *    The table is not needed when a rank owns all the points. ---*/
+
+  vector<unsigned long> rows;
+  rows.reserve(geometry->GetnPointDomain());
+  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) rows.push_back(iPoint_Global);
+  }
+
+  if (!rows.empty() && rows.back() >= nPointFile) {
+    SU2_MPI::Error(string("The SU2 restart file ") + val_filename + string(" has fewer points than the mesh."),
+                   CURRENT_FUNCTION);
+  }
+  if (rows.empty() || rows.back() + 1 == rows.size()) rows.clear();
+
+  Restart_Data.Map(std::move(file), offset, nFields, std::move(rows));
+
+  return true;
+}
+
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetGlobal_nPointDomain() == 0) return;
@@ -3308,7 +3619,7 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
     const auto iPoint = geometry->GetGlobal_to_Local_Point(iPoint_Global);
     if (iPoint >= 0) {
       for (auto iVar = 0ul; iVar < nFields; ++iVar)
-        Restart_Data[counter*nFields+iVar] = SU2_TYPE::GetValue(localVars(iPoint,iVar));
+        Restart_Data.data()[counter*nFields+iVar] = SU2_TYPE::GetValue(localVars(iPoint,iVar));
       counter++;
     }
   }
@@ -497,8 +497,13 @@ void CDeformationDriver::OutputFiles() {
 
     output_container[iZone]->LoadData(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], nullptr);
 
+    /*--- Binary input meshes are also written in binary format. ---*/
+
+    const auto meshFormat = (config_container[iZone]->GetMesh_FileFormat() == SU2_BINARY) ? OUTPUT_TYPE::MESH_BINARY
+                                                                                          : OUTPUT_TYPE::MESH;
+
     output_container[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone][INST_0][MESH_0],
-                                         OUTPUT_TYPE::MESH, driver_config->GetMesh_Out_FileName());
+                                         meshFormat, driver_config->GetMesh_Out_FileName());
 
     /*--- Set the file names for the visualization files. ---*/
 
@@ -0,0 +1,90 @@
+/*!
+ * \file CADTElemClass_tests.cpp
+ * \brief Unit tests for the nearest element search of the ADT.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../Common/include/adt/CADTElemClass.hpp"
+#include "../../../Common/include/option_structure.hpp"
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+
+TEST_CASE("Distributed nearest element search", "[ADT]") {
+
+  /*--- Each rank owns the part [rank, rank+1] of a wall on the x axis, split in 4 lines. ---*/
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  constexpr unsigned long nLine = 4;
+
+  std::vector<su2double> coor;
+  std::vector<unsigned long> conn;
+  std::vector<unsigned short> types, markers;
+  std::vector<unsigned long> elems;
+
+  for (unsigned long i = 0; i <= nLine; ++i) {
+    coor.push_back(rank + su2double(i) / nLine);
+    coor.push_back(0.0);
+  }
+  for (unsigned long i = 0; i < nLine; ++i) {
+    conn.push_back(i);
+    conn.push_back(i + 1);
+    types.push_back(LINE);
+    markers.push_back(0);
+    elems.push_back(i);
+  }
+  CADTElemClass localADT(2, coor, conn, types, markers, elems, false);
+
+  /*--- The same points on all ranks, the exact distance is known. ---*/
+
+  std::vector<su2double> points;
+  for (int i = 0; i <= 10; ++i) {
+    for (int j = 1; j <= 3; ++j) {
+      points.push_back(-1.0 + (size + 2.0) * i / 10.0);
+      points.push_back(0.5 * j);
+    }
+  }
+  const unsigned long nPoints = points.size() / 2;
+
+  std::vector<su2double> dist(nPoints);
+  std::vector<unsigned short> markerID(nPoints);
+  std::vector<unsigned long> elemID(nPoints);
+  std::vector<int> rankID(nPoints), hint(nPoints, size - 1 - rank);
+
+  localADT.DetermineNearestElementDistributed(nPoints, points.data(), hint.data(), dist.data(), markerID.data(),
+                                              elemID.data(), rankID.data());
+
+  for (unsigned long i = 0; i < nPoints; ++i) {
+    const su2double x = points[2 * i], y = points[2 * i + 1];
+    const su2double dx = std::max(0.0, std::max(-x, x - size));
+    CHECK(dist[i] == Approx(std::sqrt(dx * dx + y * y)));
+
+    /*--- The reported element must be at that distance (the wall is straight). ---*/
+    REQUIRE(rankID[i] >= 0);
+    REQUIRE(rankID[i] < size);
+    const su2double x0 = rankID[i] + su2double(elemID[i]) / nLine, x1 = x0 + 1.0 / nLine;
+    const su2double dxElem = std::max(0.0, std::max(x0 - x, x - x1));
+    CHECK(std::sqrt(dxElem * dxElem + y * y) == Approx(dist[i]));
+  }
+}
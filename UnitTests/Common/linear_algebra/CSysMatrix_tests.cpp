@@ -0,0 +1,108 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the sparse matrix formats.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+TEST_CASE("Sliced ELLPACK matrix-vector product", "[Linear algebra]") {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  /*--- An odd number of points, the last slice is padded for any SIMD length, and rows of different
+   *    sizes (corners, edges, faces, interior) are sorted within the windows. ---*/
+
+  std::stringstream ss(
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 9,7,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "LINEAR_SOLVER_PREC= JACOBI\n"
+      "LINEAR_SOLVER_SLICED_ELL= YES\n");
+  CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+
+  std::unique_ptr<CGeometry> geometry;
+  {
+    CPhysicalGeometry auxGeometry(&config, 0, 1);
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(&auxGeometry, &config));
+  }
+  geometry->SetSendReceive(&config);
+  geometry->SetBoundaries(&config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetEdges();
+  geometry->PreprocessP2PComms(geometry.get(), &config);
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  REQUIRE(nPointDomain % 2 == 1);
+
+  for (unsigned short nVar = 1; nVar <= 2; ++nVar) {
+    CSysMatrix<su2double> matrix;
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry.get(), &config);
+
+    /*--- Non-symmetric values, different for each entry of the blocks. ---*/
+
+    auto block = [&](unsigned long i, unsigned long j) {
+      std::vector<su2double> blk(nVar * nVar);
+      for (unsigned short k = 0; k < nVar * nVar; ++k) blk[k] = std::sin(1.0 + 0.7 * i + 0.3 * j + k);
+      return blk;
+    };
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      matrix.SetBlock(iPoint, iPoint, block(iPoint, iPoint).data());
+    }
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      matrix.SetBlock(iPoint, jPoint, block(iPoint, jPoint).data());
+      matrix.SetBlock(jPoint, iPoint, block(jPoint, iPoint).data());
+    }
+
+    CSysVector<su2double> vec(nPoint, nPointDomain, nVar, 0.0);
+    for (auto i = 0ul; i < nPoint * nVar; ++i) vec[i] = std::cos(0.1 * i);
+    CSysVector<su2double> prodCSR(vec), prodSliced(vec);
+
+    /*--- As in the linear solvers, the products are computed by all threads (the slices are split
+     *    in several chunks with more than one thread). ---*/
+
+    SU2_OMP_PARALLEL {
+      matrix.MatrixVectorProduct(vec, prodCSR, geometry.get(), &config);
+      matrix.UpdateSlicedValues();
+      matrix.MatrixVectorProduct(vec, prodSliced, geometry.get(), &config);
+      matrix.InvalidateSlicedValues();
+    }
+    END_SU2_OMP_PARALLEL
+
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) {
+      CHECK(prodSliced[i] == Approx(prodCSR[i]).margin(1e-14));
+    }
+  }
+  cout.rdbuf(origBuf);
+}
@@ -0,0 +1,232 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the linear solvers and preconditioners.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+
+/*!
+ * \brief Box mesh with edges, to define the sparse pattern of the matrices.
+ */
+std::unique_ptr<CGeometry> BoxGeometry(CConfig& config) {
+  std::unique_ptr<CGeometry> geometry;
+  {
+    CPhysicalGeometry auxGeometry(&config, 0, 1);
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(&auxGeometry, &config));
+  }
+  geometry->SetSendReceive(&config);
+  geometry->SetBoundaries(&config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetEdges();
+  geometry->PreprocessP2PComms(geometry.get(), &config);
+  return geometry;
+}
+
+/*!
+ * \brief 7-point Laplacian, the missing neighbors of boundary points act as homogeneous Dirichlet conditions.
+ */
+void SetPoisson(CGeometry& geometry, CSysMatrix<su2double>& matrix) {
+  const su2double diag = 6, offDiag = -1;
+  matrix.SetValZero();
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) matrix.SetBlock(iPoint, iPoint, &diag);
+  for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry.edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry.edges->GetNode(iEdge, 1);
+    matrix.SetBlock(iPoint, jPoint, &offDiag);
+    matrix.SetBlock(jPoint, iPoint, &offDiag);
+  }
+}
+
+/*!
+ * \brief Identity preconditioner, lets the solvers work with the unmodified operator.
+ */
+class CIdentityPreconditioner final : public CPreconditioner<su2double> {
+ public:
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override { v = u; }
+  bool IsIdentity() const override { return true; }
+};
+
+}  // namespace
+
+TEST_CASE("AMG preconditioner", "[Linear algebra]") {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  std::stringstream ss(
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 17,17,17\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "LINEAR_SOLVER_PREC= AMG\n");
+  CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+  auto geometry = BoxGeometry(config);
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<su2double> matrix;
+  matrix.Initialize(nPoint, nPointDomain, 1, 1, true, geometry.get(), &config);
+  SetPoisson(*geometry, matrix);
+
+  CSysVector<su2double> rhs(nPoint, nPointDomain, 1, 0.0);
+  for (auto i = 0ul; i < nPointDomain; ++i) rhs[i] = 1 + std::sin(0.1 * i);
+
+  CSysSolve<su2double> solver;
+  const CSysMatrixVectorProduct<su2double> mat_vec(matrix, geometry.get(), &config);
+  const su2double tol = 1e-8;
+
+  auto solve = [&](ENUM_LINEAR_SOLVER_PREC kind, CSysVector<su2double>& sol) {
+    std::unique_ptr<CPreconditioner<su2double>> precond(
+        CPreconditioner<su2double>::Create(kind, matrix, geometry.get(), &config));
+    precond->Build();
+    sol = su2double(0.0);
+    su2double residual = 0.0;
+    const auto iter = solver.FGMRES_LinSolver(rhs, sol, mat_vec, *precond, tol, 200, residual, false, &config);
+    CHECK(residual < tol);
+    return iter;
+  };
+
+  CSysVector<su2double> solJacobi(rhs), solAMG(rhs);
+  const auto iterJacobi = solve(JACOBI, solJacobi);
+  const auto iterAMG = solve(AMG, solAMG);
+
+  cout.rdbuf(origBuf);
+
+  /*--- The V-cycle should converge much faster than block-Jacobi on the same system. ---*/
+  CHECK(2 * iterAMG < iterJacobi);
+
+  for (auto i = 0ul; i < nPointDomain; ++i) {
+    CHECK(solAMG[i] == Approx(solJacobi[i]).epsilon(1e-6));
+  }
+}
+
+TEST_CASE("Pipelined Krylov solvers", "[Linear algebra]") {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  std::stringstream ss(
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 9,8,7\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "LINEAR_SOLVER_PREC= JACOBI\n");
+  CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+  auto geometry = BoxGeometry(config);
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 2;
+
+  CSysMatrix<su2double> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry.get(), &config);
+
+  CSysSolve<su2double> solver;
+  const CSysMatrixVectorProduct<su2double> mat_vec(matrix, geometry.get(), &config);
+
+  SECTION("Same solution as the classic solvers") {
+    /*--- Non-symmetric (convection-diffusion like) system with coupled variables. ---*/
+
+    const su2double diag[] = {8, 1, -1, 7};
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) matrix.SetBlock(iPoint, iPoint, diag);
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      const su2double upwind[] = {-1.5, 0.1, 0, -1.4};
+      const su2double downwind[] = {-0.5, 0, -0.1, -0.6};
+      matrix.SetBlock(iPoint, jPoint, upwind);
+      matrix.SetBlock(jPoint, iPoint, downwind);
+    }
+
+    CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0);
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) rhs[i] = std::cos(0.3 * i);
+
+    std::unique_ptr<CPreconditioner<su2double>> precond(
+        CPreconditioner<su2double>::Create(JACOBI, matrix, geometry.get(), &config));
+    precond->Build();
+
+    const su2double tol = 1e-10;
+    const unsigned long maxIter = 200;
+    std::vector<CSysVector<su2double>> sol(4, rhs);
+    su2double residual[4] = {};
+    for (auto& x : sol) x = su2double(0.0);
+
+    solver.FGMRES_LinSolver(rhs, sol[0], mat_vec, *precond, tol, maxIter, residual[0], false, &config);
+    solver.PFGMRES_LinSolver(rhs, sol[1], mat_vec, *precond, tol, maxIter, residual[1], false, &config);
+    solver.BCGSTAB_LinSolver(rhs, sol[2], mat_vec, *precond, tol, maxIter, residual[2], false, &config);
+    solver.PBCGSTAB_LinSolver(rhs, sol[3], mat_vec, *precond, tol, maxIter, residual[3], false, &config);
+
+    cout.rdbuf(origBuf);
+
+    for (int k = 0; k < 4; ++k) CHECK(residual[k] < tol);
+
+    for (int k = 1; k < 4; ++k) {
+      for (auto i = 0ul; i < nPointDomain * nVar; ++i) {
+        CHECK(sol[k][i] == Approx(sol[0][i]).margin(1e-8));
+      }
+    }
+  }
+
+  SECTION("Breakdown of the pipelined BiCGStab") {
+    /*--- Skew-symmetric operator without diagonal, for a rhs with a single non-zero r.(A r) is exactly 0,
+     *    i.e. the first step-length would be a division by zero. ---*/
+
+    const su2double zero[] = {0, 0, 0, 0};
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) matrix.SetBlock(iPoint, iPoint, zero);
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      const su2double plus[] = {1, 0, 0, 1}, minus[] = {-1, 0, 0, -1};
+      matrix.SetBlock(iPoint, jPoint, plus);
+      matrix.SetBlock(jPoint, iPoint, minus);
+    }
+
+    CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(rhs);
+    rhs[nVar * (nPointDomain / 2)] = 1;
+
+    const CIdentityPreconditioner precond;
+    su2double residual = 0.0;
+    const auto iter = solver.PBCGSTAB_LinSolver(rhs, sol, mat_vec, precond, 1e-10, 50, residual, false, &config);
+
+    cout.rdbuf(origBuf);
+
+    /*--- The solver stops without updating the solution instead of producing NaN. ---*/
+    CHECK(iter == 0);
+    CHECK(residual == Approx(1));
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) CHECK(sol[i] == 0);
+  }
+}
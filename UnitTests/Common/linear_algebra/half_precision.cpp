@@ -0,0 +1,73 @@
+/*!
+ * \file half_precision.cpp
+ * \brief Unit tests for the 16 bit storage formats of the preconditioners.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../Common/include/linear_algebra/half_precision.hpp"
+
+using namespace HalfPrecision;
+
+TEST_CASE("FP16 round trip", "[Half precision]") {
+  /*--- Every finite half value must survive decoding and encoding. ---*/
+  for (uint32_t h = 0; h < 0x10000u; ++h) {
+    if ((h & 0x7c00u) == 0x7c00u) continue;
+    CHECK(Float16::Encode(Float16::Decode(h)) == h);
+  }
+}
+
+TEST_CASE("FP16 rounding and range", "[Half precision]") {
+  CHECK(Float16::Decode(Float16::Encode(1.0f)) == 1.0f);
+  CHECK(Float16::Decode(Float16::Encode(-2.5f)) == -2.5f);
+  /*--- Ties round to even, 1 + 2^-11 is halfway between 1 and the next half. ---*/
+  CHECK(Float16::Decode(Float16::Encode(1.0f + std::ldexp(1.0f, -11))) == 1.0f);
+  CHECK(Float16::Decode(Float16::Encode(65504.0f)) == 65504.0f);
+  CHECK(std::isinf(Float16::Decode(Float16::Encode(65520.0f))));
+  CHECK(Float16::Decode(Float16::Encode(std::ldexp(1.0f, -24))) == std::ldexp(1.0f, -24));
+  CHECK(Float16::Decode(Float16::Encode(1e-9f)) == 0.0f);
+}
+
+TEST_CASE("FP16 saturation", "[Half precision]") {
+  /*--- Values that would overflow to infinity are clamped to the largest finite value. ---*/
+  CHECK(Float16::Decode(Float16::EncodeSaturated(65520.0f)) == Float16::Max());
+  CHECK(Float16::Decode(Float16::EncodeSaturated(-1e30f)) == -Float16::Max());
+  CHECK(Float16::Decode(Float16::EncodeSaturated(INFINITY)) == Float16::Max());
+  CHECK(std::isnan(Float16::Decode(Float16::EncodeSaturated(NAN))));
+  /*--- In range values are encoded as usual. ---*/
+  for (float x = 1e-7f; x < 65504.0f; x *= 1.37f) {
+    CHECK(Float16::EncodeSaturated(x) == Float16::Encode(x));
+    CHECK(Float16::EncodeSaturated(-x) == Float16::Encode(-x));
+  }
+}
+
+TEST_CASE("BF16 accuracy", "[Half precision]") {
+  CHECK(BFloat16::Decode(BFloat16::Encode(1.0f)) == 1.0f);
+  CHECK(std::isnan(BFloat16::Decode(BFloat16::Encode(NAN))));
+
+  for (float x = 1e-30f; x < 1e30f; x *= 1.37f) {
+    CHECK(std::abs(BFloat16::Decode(BFloat16::Encode(x)) - x) <= std::ldexp(x, -8));
+    CHECK(std::abs(BFloat16::Decode(BFloat16::Encode(-x)) + x) <= std::ldexp(x, -8));
+  }
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file CBinomialCheckpointing_tests.cpp
+ * \brief Unit tests for the binomial checkpointing schedule.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <limits>
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+
+namespace {
+
+/*--- Reverse nSteps steps, checks the checkpoints, and returns the number of advanced steps. ---*/
+
+unsigned long Reverse(long nSteps, unsigned short nCheckpoints) {
+  CBinomialCheckpointing schedule(nCheckpoints);
+
+  for (long target = nSteps - 1; target >= 0; --target) {
+    const long start = schedule.Restore(target);
+    REQUIRE(start <= target);
+    for (auto step : schedule.GetCheckpoints()) REQUIRE(step <= target);
+
+    for (long step = start + 1; step < target; ++step) {
+      if (schedule.Store(step, target)) REQUIRE(schedule.GetCheckpoints().back() == step);
+      REQUIRE(schedule.GetCheckpoints().size() <= nCheckpoints);
+    }
+  }
+  return schedule.GetnAdvances();
+}
+
+}  // namespace
+
+TEST_CASE("Binomial coefficients", "[Toolboxes]") {
+  CHECK(CBinomialCheckpointing::Beta(0, 5) == 1);
+  CHECK(CBinomialCheckpointing::Beta(3, 0) == 1);
+  CHECK(CBinomialCheckpointing::Beta(2, 3) == 10);
+  CHECK(CBinomialCheckpointing::Beta(10, 10) == 184756);
+  CHECK(CBinomialCheckpointing::Beta(200, 200) == std::numeric_limits<unsigned long>::max());
+}
+
+TEST_CASE("Binomial checkpointing schedule", "[Toolboxes]") {
+
+  /*--- Without checkpoints every request starts from the initial condition. ---*/
+
+  CHECK(Reverse(10, 0) == 55);
+
+  /*--- With enough checkpoints every step is computed only once. ---*/
+
+  CHECK(Reverse(10, 9) == 10);
+
+  /*--- The number of recomputations of each step is bounded by the smallest r with beta(s,r) >= n. ---*/
+
+  for (unsigned short s : {1, 2, 3, 5}) {
+    for (long n : {7L, 20L, 100L, 1000L}) {
+      unsigned long r = 0;
+      while (CBinomialCheckpointing::Beta(s, r) < static_cast<unsigned long>(n)) ++r;
+      CHECK(Reverse(n, s) <= (r + 1) * n);
+    }
+  }
+
+  /*--- 2 checkpoints, 10 = beta(2,3) steps. ---*/
+
+  CBinomialCheckpointing schedule(2);
+  CHECK(schedule.Restore(9) == -1);
+  for (long step = 0; step < 9; ++step) schedule.Store(step, 9);
+  REQUIRE(schedule.GetCheckpoints().size() == 2);
+  CHECK(schedule.GetCheckpoints()[0] == 5);
+  CHECK(schedule.GetCheckpoints()[1] == 8);
+  CHECK(schedule.Restore(8) == 8);
+  CHECK(schedule.Restore(7) == 5);
+}
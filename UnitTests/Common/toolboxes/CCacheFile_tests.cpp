@@ -0,0 +1,57 @@
+/*!
+ * \file CCacheFile_tests.cpp
+ * \brief Unit tests for the cache files of the partitioning and wall distance.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "../../../Common/include/toolboxes/CCacheFile.hpp"
+
+TEST_CASE("Cache file round trip and validation", "[Toolboxes]") {
+
+  const std::string fileName = "cache_file_test.dat";
+  const double coords[] = {0.0, 0.5, 1.0};
+  const uint64_t key = 7, localKey = CCacheFile::Hash(coords, sizeof(coords));
+
+  CHECK(CCacheFile::Hash(coords, sizeof(coords)) != CCacheFile::Hash(coords, 2 * sizeof(double)));
+
+  std::vector<char> data(40);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i);
+  CCacheFile::Write(fileName, key, localKey, data);
+
+  std::vector<char> read(data.size(), 0);
+  CHECK(CCacheFile::Read(fileName, key, localKey, read));
+  CHECK(read == data);
+
+  /*--- Any change of the keys or of the expected size invalidates the cache. ---*/
+
+  CHECK_FALSE(CCacheFile::Read(fileName, key + 1, localKey, read));
+  CHECK_FALSE(CCacheFile::Read(fileName, key, localKey + 1, read));
+  std::vector<char> larger(data.size() + 1);
+  CHECK_FALSE(CCacheFile::Read(fileName, key, localKey, larger));
+  CHECK_FALSE(CCacheFile::Read("missing_" + fileName, key, localKey, read));
+
+  std::remove(fileName.c_str());
+}
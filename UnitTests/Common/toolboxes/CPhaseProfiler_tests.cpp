@@ -0,0 +1,111 @@
+/*!
+ * \file CPhaseProfiler_tests.cpp
+ * \brief Unit tests for the hierarchical phase timer.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
+
+TEST_CASE("Phase profiler nesting and accumulation", "[Toolboxes]") {
+
+  CPhaseProfiler profiler;
+
+  for (int iZone = 0; iZone < 2; ++iZone) {
+    CPhaseProfiler::CScope geometry(profiler, "Geometry");
+    profiler.Start("Edges");
+    profiler.Stop();
+    CPhaseProfiler::CScope volumes(profiler, "Control volumes");
+  }
+  profiler.Start("Solver");
+  profiler.Stop();
+
+  /*--- Phases are listed in the order they are first started. ---*/
+
+  REQUIRE(profiler.GetnPhases() == 4);
+  CHECK(profiler.GetPath(0) == "Geometry");
+  CHECK(profiler.GetPath(1) == "Geometry/Edges");
+  CHECK(profiler.GetPath(2) == "Geometry/Control volumes");
+  CHECK(profiler.GetPath(3) == "Solver");
+
+  CHECK(profiler.GetDepth(0) == 0);
+  CHECK(profiler.GetDepth(1) == 1);
+  CHECK(profiler.GetDepth(3) == 0);
+
+  CHECK(profiler.GetnCalls(0) == 2);
+  CHECK(profiler.GetnCalls(2) == 2);
+  CHECK(profiler.GetnCalls(3) == 1);
+
+  /*--- A parent includes the time of its children. ---*/
+
+  CHECK(profiler.GetTime(0) >= profiler.GetTime(1) + profiler.GetTime(2));
+
+  std::ostringstream table;
+  profiler.Report("Test", "", &table);
+  CHECK(table.str().find("  Control volumes") != std::string::npos);
+
+  profiler.Clear();
+  CHECK(profiler.GetnPhases() == 0);
+}
+
+TEST_CASE("Phase profiler memory high-water mark", "[Toolboxes]") {
+
+  if (!CPhaseProfiler::ResetPeakMemory()) return;
+
+  CPhaseProfiler profiler;
+  const size_t nBytes = 64 << 20;
+  {
+    CPhaseProfiler::CScope outer(profiler, "Outer");
+    {
+      CPhaseProfiler::CScope allocation(profiler, "Allocation");
+      std::vector<char> buffer(nBytes, 1);
+      CHECK(buffer.back() == 1);
+    }
+    CPhaseProfiler::CScope after(profiler, "After");
+  }
+
+  /*--- The peak of a phase after the global peak is its own, the parent includes the peak of its children. ---*/
+
+  std::ostringstream table;
+  profiler.Report("Test", "profiler_test.json", &table);
+  std::ifstream json("profiler_test.json");
+  std::vector<double> peaks;
+  std::string token;
+  while (json >> token) {
+    if (token == "\"memory_hwm_max_mb\":") {
+      double val;
+      json >> val;
+      peaks.push_back(val);
+    }
+  }
+  std::remove("profiler_test.json");
+
+  REQUIRE(peaks.size() == 3);
+  CHECK(peaks[1] - peaks[2] > 0.5 * nBytes / (1024.0 * 1024.0));
+  CHECK(peaks[0] >= peaks[1]);
+}
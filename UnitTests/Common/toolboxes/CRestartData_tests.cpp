@@ -0,0 +1,73 @@
+/*!
+ * \file CRestartData_tests.cpp
+ * \brief Unit tests for the restart data container with a memory mapped file.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "../../../Common/include/toolboxes/CRestartData.hpp"
+
+TEST_CASE("Restart data in a mapped file", "[Toolboxes]") {
+
+  if (!CMemoryMappedFile::IsSupported()) return;
+
+  /*--- A header of odd size (as in SU2 restart files) followed by 10 rows of 3 values. ---*/
+
+  const unsigned long nFields = 3, nRows = 10;
+  const size_t offset = 53;
+  const std::string fileName = "restart_data_test.dat";
+
+  FILE* file = fopen(fileName.c_str(), "wb");
+  REQUIRE(file != nullptr);
+  for (size_t i = 0; i < offset; ++i) fputc('h', file);
+  for (unsigned long i = 0; i < nRows * nFields; ++i) {
+    const passivedouble val = i;
+    fwrite(&val, sizeof(passivedouble), 1, file);
+  }
+  fclose(file);
+
+  CMemoryMappedFile mapped(fileName);
+  REQUIRE(mapped.IsOpen());
+  CHECK(mapped.Size() == offset + nRows * nFields * sizeof(passivedouble));
+
+  CRestartData data;
+  data.Map(std::move(mapped), offset, nFields, {1, 4, 9});
+  CHECK(data.IsMapped());
+  CHECK(!mapped.IsOpen());
+
+  /*--- Local point i is row rows[i] of the file. ---*/
+  CHECK(data[0] == 3.0);
+  CHECK(data[2] == 5.0);
+  CHECK(data[1 * nFields + 1] == 13.0);
+  CHECK(data[2 * nFields + 2] == 29.0);
+
+  /*--- Resizing releases the mapping and uses the buffer. ---*/
+  data.resize(4);
+  CHECK(!data.IsMapped());
+  data.data()[3] = 1.0;
+  CHECK(data[3] == 1.0);
+
+  std::remove(fileName.c_str());
+}
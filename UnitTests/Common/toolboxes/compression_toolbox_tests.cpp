@@ -0,0 +1,93 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests for the block compression of floating point arrays.
+ * \version 8.0.1 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstring>
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+using namespace CompressionToolbox;
+
+namespace {
+/*--- Smooth fields of different magnitude, plus some special values. ---*/
+std::vector<double> TestBlock(unsigned long nPoint, unsigned long nField) {
+  std::vector<double> data(nPoint * nField);
+  for (auto i = 0ul; i < nPoint; ++i)
+    for (auto j = 0ul; j < nField; ++j) data[i * nField + j] = std::sin(0.01 * i + j) * std::pow(10.0, 3.0 * j - 4);
+  data[0] = 0.0;
+  data[1] = -0.0;
+  data[2] = INFINITY;
+  data[3] = 1e300;
+  data[4] = std::ldexp(1.0, -1070);
+  return data;
+}
+}  // namespace
+
+TEST_CASE("Lossless block compression", "[Compression]") {
+  const unsigned long nPoint = 1001, nField = 5;
+  const auto data = TestBlock(nPoint, nField);
+  const std::vector<int> droppedBits(nField, 0);
+
+  std::vector<uint8_t> buffer;
+  CompressBlock(data.data(), nPoint, nField, droppedBits.data(), buffer);
+  CHECK(buffer.size() < data.size() * sizeof(double));
+
+  std::vector<double> result(data.size());
+  REQUIRE(DecompressBlock(buffer.data(), buffer.size(), nPoint, nField, droppedBits.data(), result.data()));
+  CHECK(memcmp(data.data(), result.data(), data.size() * sizeof(double)) == 0);
+
+  /*--- Truncated blocks are detected. ---*/
+  CHECK_FALSE(DecompressBlock(buffer.data(), buffer.size() - 1, nPoint, nField, droppedBits.data(), result.data()));
+}
+
+TEST_CASE("Lossy block compression", "[Compression]") {
+  CHECK(DroppedBits(0.0) == 0);
+  CHECK(DroppedBits(1e-20) == 0);
+
+  const unsigned long nPoint = 777, nField = 4;
+  const auto data = TestBlock(nPoint, nField);
+
+  for (const double tol : {1e-3, 1e-6, 1e-10}) {
+    /*--- The first field stays lossless. ---*/
+    std::vector<int> droppedBits(nField, DroppedBits(tol));
+    droppedBits[0] = 0;
+
+    std::vector<uint8_t> buffer;
+    CompressBlock(data.data(), nPoint, nField, droppedBits.data(), buffer);
+    std::vector<double> result(data.size());
+    REQUIRE(DecompressBlock(buffer.data(), buffer.size(), nPoint, nField, droppedBits.data(), result.data()));
+
+    for (auto i = 0ul; i < nPoint; ++i) {
+      CHECK(result[i * nField] == data[i * nField]);
+      for (auto j = 1ul; j < nField; ++j) {
+        const double x = data[i * nField + j];
+        if (std::isinf(x) || std::fpclassify(x) == FP_SUBNORMAL) continue;
+        CHECK(std::abs(result[i * nField + j] - x) <= tol * std::abs(x));
+      }
+    }
+  }
+}
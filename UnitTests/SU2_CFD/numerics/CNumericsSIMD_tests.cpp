@@ -0,0 +1,196 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Unit tests for the selection of the vectorized numerics.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/CNumericsSIMD.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
+#include "../../../SU2_CFD/include/variables/CEulerVariable.hpp"
+
+namespace {
+
+/*--- If the vectorized path reports support for a scheme it must also be able to create it. ---*/
+void checkUpwindScheme(const char* scheme, const char* fluid, bool expectSupported) {
+  std::stringstream config_options;
+  config_options << "SOLVER= EULER\n";
+  config_options << "CONV_NUM_METHOD_FLOW= " << scheme << "\n";
+  config_options << "FLUID_MODEL= " << fluid << "\n";
+  config_options << "MUSCL_FLOW= NO\n";
+  config_options << "MACH_NUMBER= 0.8\n";
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+
+  const bool supported = CNumericsSIMD::SupportsUpwindScheme(config, MESH_0);
+  CHECK(supported == expectSupported);
+
+  if (supported) {
+    for (int nDim = 2; nDim <= 3; ++nDim) {
+      CNumericsSIMD* numerics = CNumericsSIMD::CreateNumerics(config, nDim, MESH_0);
+      CHECK(numerics != nullptr);
+      delete numerics;
+    }
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Upwind schemes of the vectorized numerics", "[Numerics SIMD]") {
+  for (const char* scheme : {"ROE", "HLLC", "AUSMPLUSUP", "AUSMPLUSUP2", "SLAU", "SLAU2"}) {
+    SECTION(scheme) {
+      checkUpwindScheme(scheme, "IDEAL_GAS", true);
+
+      /*--- Without reconstruction only Roe is implemented for general gases, the config
+       * only allows Roe and HLLC to be combined with non-ideal fluid models. ---*/
+      const std::string name(scheme);
+      if (name == "ROE" || name == "HLLC") checkUpwindScheme(scheme, "PR_GAS", name == "ROE");
+    }
+  }
+}
+
+TEST_CASE("Vectorized general gas Roe scheme", "[Numerics SIMD]") {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  std::stringstream config_options(
+      "SOLVER= EULER\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "MUSCL_FLOW= NO\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "FLUID_MODEL= PR_GAS\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 4,4,4\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n");
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+
+  std::unique_ptr<CGeometry> geometry;
+  {
+    CPhysicalGeometry auxGeometry(&config, 0, 1);
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(&auxGeometry, &config));
+  }
+  geometry->SetSendReceive(&config);
+  geometry->SetBoundaries(&config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetElement_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->Check_IntElem_Orientation(&config);
+  geometry->Check_BoundElem_Orientation(&config);
+  geometry->SetEdges();
+  geometry->SetVertex(&config);
+  geometry->SetControlVolume(&config, ALLOCATE);
+  geometry->SetBoundControlVolume(&config, ALLOCATE);
+
+  constexpr unsigned short nDim = 3, nVar = nDim + 2;
+  const auto nPoint = geometry->GetnPoint();
+  const auto nEdge = geometry->GetnEdge();
+
+  /*--- Dense CO2-like states where the Peng-Robinson gas is far from ideal. ---*/
+
+  CPengRobinson fluidModel(1.3, 188.9, 7.38e6, 304.1, 0.228);
+
+  const su2double velocity0[nDim] = {0.0};
+  CEulerVariable nodes(1.0, velocity0, 1.0, nPoint, nDim, nVar, &config);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    fluidModel.SetTDState_PT(7e6 * (1 + 0.15 * sin(iPoint)), 350 * (1 + 0.03 * cos(3 * iPoint)));
+    const su2double density = fluidModel.GetDensity();
+    su2double solution[nVar] = {density}, velocity2 = 0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const su2double velocity = 20 * sin(iPoint + iDim) + 10 * iDim;
+      solution[iDim + 1] = density * velocity;
+      velocity2 += velocity * velocity;
+    }
+    solution[nDim + 1] = density * (fluidModel.GetStaticEnergy() + 0.5 * velocity2);
+    nodes.SetSolution(iPoint, solution);
+    REQUIRE(nodes.SetPrimVar(iPoint, &fluidModel));
+    nodes.SetSecondaryVar(iPoint, &fluidModel);
+  }
+
+  /*--- Assemble the residual and Jacobian with the vectorized and with the classic numerics. ---*/
+
+  CSysVector<su2double> resSIMD(nPoint, nPoint, nVar, 0.0), resScalar(nPoint, nPoint, nVar, 0.0);
+  SparseMatrixType jacSIMD, jacScalar;
+  jacSIMD.Initialize(nPoint, nPoint, nVar, nVar, true, geometry.get(), &config);
+  jacScalar.Initialize(nPoint, nPoint, nVar, nVar, true, geometry.get(), &config);
+
+  REQUIRE(CNumericsSIMD::SupportsUpwindScheme(config, MESH_0));
+  std::unique_ptr<CNumericsSIMD> numericsSIMD(CNumericsSIMD::CreateNumerics(config, nDim, MESH_0));
+  REQUIRE(numericsSIMD != nullptr);
+
+  for (auto k = 0ul; k < nEdge; k += Double::Size) {
+    Int iEdge;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      const bool in = (k + j < nEdge);
+      mask[j] = in;
+      iEdge[j] = in ? k + j : k;
+    }
+    numericsSIMD->ComputeFlux(iEdge, config, *geometry, nodes, UpdateType::COLORING, mask, resSIMD, jacSIMD);
+  }
+
+  CUpwGeneralRoe_Flow numerics(nDim, nVar, &config);
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+    numerics.SetNormal(geometry->edges->GetNormal(iEdge));
+    numerics.SetPrimitive(nodes.GetPrimitive(iPoint), nodes.GetPrimitive(jPoint));
+    numerics.SetSecondary(nodes.GetSecondary(iPoint), nodes.GetSecondary(jPoint));
+    const auto residual = numerics.ComputeResidual(&config);
+
+    resScalar.AddBlock(iPoint, residual);
+    resScalar.SubtractBlock(jPoint, residual);
+    jacScalar.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+  cout.rdbuf(origBuf);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      CHECK(resSIMD(iPoint, iVar) == Approx(resScalar(iPoint, iVar)).margin(1e-6));
+    }
+  }
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      for (unsigned short jVar = 0; jVar < nVar; ++jVar) {
+        CHECK(jacSIMD.GetBlock(iPoint, jPoint, iVar, jVar) ==
+              Approx(jacScalar.GetBlock(iPoint, jPoint, iVar, jVar)).margin(1e-8));
+        CHECK(jacSIMD.GetBlock(iPoint, iPoint, iVar, jVar) ==
+              Approx(jacScalar.GetBlock(iPoint, iPoint, iVar, jVar)).margin(1e-8));
+      }
+    }
+  }
+}
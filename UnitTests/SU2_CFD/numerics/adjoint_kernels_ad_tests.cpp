@@ -0,0 +1,106 @@
+/*!
+ * \file adjoint_kernels_ad_tests.cpp
+ * \brief Unit tests for the recording of the hand-differentiated flux kernels (reverse AD).
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../../SU2_CFD/include/numerics_simd/flow/diffusion/common.hpp"
+
+namespace {
+
+/*!
+ * \brief Tape the viscous flux of one pack of edges, either operation by operation with the SIMD
+ * functions, or as external functions, and return the adjoints of the inputs.
+ */
+template<size_t nDim>
+std::vector<double> viscousFluxAdjoints(bool external) {
+  using Kernel = CViscousFluxKernel<nDim>;
+  Double x[Kernel::nIn];
+  for (size_t i = 0; i < Kernel::nIn; ++i) {
+    for (size_t k = 0; k < Double::Size; ++k) x[i][k] = 0.5 + 0.37*((7*i + 3*k) % 11) / 11.0;
+  }
+
+  AD::Reset();
+  AD::StartRecording();
+  for (size_t i = 0; i < Kernel::nIn; ++i) {
+    for (size_t k = 0; k < Double::Size; ++k) AD::RegisterInput(x[i][k]);
+  }
+  CHECK(useExternalKernels());
+
+  VectorDbl<Kernel::nOut> y;
+  if (external) {
+    const Double* in[Kernel::nIn];
+    for (size_t i = 0; i < Kernel::nIn; ++i) in[i] = &x[i];
+    CExternalKernel<Kernel>::record(in, y);
+  } else {
+    CCompressiblePrimitives<nDim,nDim+7> V;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) V.velocity(iDim) = x[iDim];
+    MatrixDbl<nDim+1,nDim> grad;
+    for (size_t iVar = 0; iVar < nDim+1; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim) grad(iVar,iDim) = x[nDim+2+iVar*nDim+iDim];
+    VectorDbl<nDim> normal, heatFlux;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      normal(iDim) = x[nDim+2+Kernel::nGrad+iDim];
+      heatFlux(iDim) = x[nDim+1] * grad(0,iDim);
+    }
+    const auto tau = stressTensor(x[nDim], grad);
+    const auto flux = viscousFlux<nDim+2>(V, tau, heatFlux, normal);
+    for (size_t i = 0; i < Kernel::nOut; ++i) y(i) = flux(i+1) * x[2*nDim+2+Kernel::nGrad];
+  }
+
+  for (size_t i = 0; i < Kernel::nOut; ++i) {
+    for (size_t k = 0; k < Double::Size; ++k) AD::RegisterOutput(y(i)[k]);
+  }
+  AD::StopRecording();
+
+  for (size_t i = 0; i < Kernel::nOut; ++i) {
+    for (size_t k = 0; k < Double::Size; ++k) SU2_TYPE::SetDerivative(y(i)[k], 0.3 + 0.2*i + 0.1*k);
+  }
+  AD::ComputeAdjoint();
+
+  std::vector<double> x_b;
+  for (size_t i = 0; i < Kernel::nIn; ++i) {
+    for (size_t k = 0; k < Double::Size; ++k) x_b.push_back(SU2_TYPE::GetDerivative(x[i][k]));
+  }
+  AD::Reset();
+  return x_b;
+}
+
+template<size_t nDim>
+void checkViscousFlux() {
+  const auto reference = viscousFluxAdjoints<nDim>(false);
+  const auto external = viscousFluxAdjoints<nDim>(true);
+  REQUIRE(reference.size() == external.size());
+  for (size_t i = 0; i < reference.size(); ++i) {
+    CHECK(external[i] == Approx(reference[i]).margin(1e-12));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Viscous flux external function", "[AD tests]") {
+  checkViscousFlux<2>();
+  checkViscousFlux<3>();
+}
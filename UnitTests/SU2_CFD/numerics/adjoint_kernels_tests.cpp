@@ -0,0 +1,101 @@
+/*!
+ * \file adjoint_kernels_tests.cpp
+ * \brief Unit tests for the hand-differentiated flux kernels.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../SU2_CFD/include/numerics_simd/flow/diffusion/common.hpp"
+
+namespace {
+
+/*--- Deterministic pseudo-random inputs in [0.5, 1.5). ---*/
+template<size_t N>
+void fillInputs(double (&x)[N], unsigned seed) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    x[i] = 0.5 + (seed >> 8) / double(1u << 24);
+  }
+}
+
+/*--- Compare the reverse derivatives with central finite differences of the primal (dot product test). ---*/
+template<class Kernel>
+void checkReverse(unsigned seed) {
+  double x[Kernel::nIn], x_b[Kernel::nIn], y_b[Kernel::nOut];
+  fillInputs(x, seed);
+  for (size_t i = 0; i < Kernel::nOut; ++i) y_b[i] = 0.3 + 0.2*i;
+
+  Kernel::reverse(x, x_b, y_b);
+
+  const double h = 1e-6;
+  for (size_t i = 0; i < Kernel::nIn; ++i) {
+    double xp[Kernel::nIn], xm[Kernel::nIn], yp[Kernel::nOut], ym[Kernel::nOut];
+    for (size_t j = 0; j < Kernel::nIn; ++j) xp[j] = xm[j] = x[j];
+    xp[i] += h;
+    xm[i] -= h;
+    Kernel::primal(xp, yp);
+    Kernel::primal(xm, ym);
+
+    double fd = 0.0;
+    for (size_t j = 0; j < Kernel::nOut; ++j) fd += y_b[j] * (yp[j] - ym[j]) / (2*h);
+
+    CHECK(x_b[i] == Approx(fd).epsilon(1e-6).margin(1e-8));
+  }
+}
+
+template<size_t nDim>
+void checkViscousPrimal(unsigned seed) {
+  using Kernel = CViscousFluxKernel<nDim>;
+  double x[Kernel::nIn], y[Kernel::nOut];
+  fillInputs(x, seed);
+
+  CCompressiblePrimitives<nDim,nDim+7> V;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) V.velocity(iDim) = x[iDim];
+  MatrixDbl<nDim+1,nDim> grad;
+  for (size_t iVar = 0; iVar < nDim+1; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim) grad(iVar,iDim) = x[nDim+2+iVar*nDim+iDim];
+  VectorDbl<nDim> normal, heatFlux;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    normal(iDim) = x[nDim+2+Kernel::nGrad+iDim];
+    heatFlux(iDim) = x[nDim+1] * grad(0,iDim);
+  }
+  const double area = x[2*nDim+2+Kernel::nGrad];
+
+  Kernel::primal(x, y);
+  const auto tau = stressTensor(Double(x[nDim]), grad);
+  const auto flux = viscousFlux<nDim+2>(V, tau, heatFlux, normal);
+  for (size_t i = 0; i < Kernel::nOut; ++i) CHECK(y[i] == Approx(flux(i+1)[0] * area));
+}
+
+}  // namespace
+
+TEST_CASE("Viscous flux kernel", "[Adjoint kernels]") {
+  for (unsigned seed = 1; seed < 4; ++seed) {
+    checkViscousPrimal<2>(seed);
+    checkViscousPrimal<3>(seed);
+    checkReverse<CViscousFluxKernel<2> >(seed);
+    checkReverse<CViscousFluxKernel<3> >(seed);
+  }
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file CExtractFVMDataSorter_tests.cpp
+ * \brief Unit tests for the selection of the elements of the extraction output.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <sstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CExtractFVMDataSorter.hpp"
+
+namespace {
+/*!
+ * \brief Extract the elements of a unit cube with 4x4x4 hexahedra, the iso-field is the x coordinate.
+ * \param[in] options - Extraction options.
+ * \param[out] xRange - Range of x of the extracted points.
+ * \return Number of extracted elements.
+ */
+unsigned long Extract(const std::string& options, std::array<passivedouble, 2>& xRange) {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  std::stringstream ss(
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n" + options);
+  CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+
+  std::unique_ptr<CGeometry> geometry;
+  {
+    CPhysicalGeometry auxGeometry(&config, 0, 1);
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(&auxGeometry, &config));
+  }
+  geometry->SetSendReceive(&config);
+  geometry->SetBoundaries(&config);
+
+  const vector<string> fieldNames = {"x", "y", "z", "Iso"};
+  CFVMDataSorter volumeSorter(&config, geometry.get(), fieldNames);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      volumeSorter.SetUnsortedData(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    volumeSorter.SetUnsortedData(iPoint, 3, geometry->nodes->GetCoord(iPoint, 0));
+  }
+
+  CExtractFVMDataSorter sorter(&config, geometry.get(), &volumeSorter, fieldNames, {0, 1, 2, 3}, 3);
+  sorter.SortOutputData();
+
+  xRange = {1.0, 0.0};
+  for (auto iPoint = 0ul; iPoint < sorter.GetnPoints(); iPoint++) {
+    xRange[0] = std::min(xRange[0], sorter.GetData(0, iPoint));
+    xRange[1] = std::max(xRange[1], sorter.GetData(0, iPoint));
+    CHECK(sorter.GetData(3, iPoint) == sorter.GetData(0, iPoint));
+  }
+  cout.rdbuf(origBuf);
+
+  CHECK(sorter.GetnElem() == sorter.GetnElem(HEXAHEDRON));
+  return sorter.GetnElem();
+}
+}  // namespace
+
+TEST_CASE("Extraction of elements", "[Output]") {
+  std::array<passivedouble, 2> xRange;
+
+  /*--- Elements with at least one point in the box. ---*/
+  CHECK(Extract("EXTRACT_KIND= BOX\nEXTRACT_BOX= (0, 0, 0, 0.3, 0.3, 0.3)\n", xRange) == 8);
+  CHECK(xRange[1] == Approx(0.5));
+
+  /*--- Elements cut by the plane x = 0.3. ---*/
+  CHECK(Extract("EXTRACT_KIND= SLICE\nEXTRACT_PLANE= (0.3, 0, 0, 1, 0, 0)\n", xRange) == 16);
+  CHECK(xRange[0] == Approx(0.25));
+  CHECK(xRange[1] == Approx(0.5));
+
+  /*--- Elements cut by the iso-surface, when it passes through points both neighbors are selected. ---*/
+  CHECK(Extract("EXTRACT_KIND= ISOSURFACE\nEXTRACT_ISOSURFACE_VALUE= 0.3\n", xRange) == 16);
+  CHECK(xRange[0] == Approx(0.25));
+  CHECK(xRange[1] == Approx(0.5));
+
+  CHECK(Extract("EXTRACT_KIND= ISOSURFACE\nEXTRACT_ISOSURFACE_VALUE= 0.5\n", xRange) == 32);
+  CHECK(xRange[0] == Approx(0.25));
+  CHECK(xRange[1] == Approx(0.75));
+
+  CHECK(Extract("EXTRACT_KIND= ISOSURFACE\nEXTRACT_ISOSURFACE_VALUE= 2\n", xRange) == 0);
+}
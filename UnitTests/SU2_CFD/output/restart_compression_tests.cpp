@@ -0,0 +1,77 @@
+/*!
+ * \file restart_compression_tests.cpp
+ * \brief Unit tests for the lossy compression of restart files.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../../SU2_CFD/include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+TEST_CASE("Restart fields survive lossy restarts", "[Restart]") {
+  /*--- Name and output group of some of the fields of structural and transitional restarts. ---*/
+  const std::vector<std::pair<std::string, std::string>> fields = {
+      {"COORD-X", "COORDINATES"},         {"DISPLACEMENT-X", "SOLUTION"},
+      {"VELOCITY-X", "VELOCITY"},         {"ACCELERATION-X", "ACCELERATION"},
+      {"INTERMITTENCY_SEP", "PRIMITIVE"}, {"INTERMITTENCY_EFF", "PRIMITIVE"},
+      {"VON_MISES_STRESS", "STRESS"},     {"PRESSURE_COEFF", "PRIMITIVE"}};
+  const unsigned long nPoint = 501, nField = fields.size();
+  const double tol = 1e-3;
+
+  std::vector<int> droppedBits(nField);
+  for (auto j = 0ul; j < nField; ++j) {
+    const bool exact = COutput::IsRestartField(fields[j].first, fields[j].second);
+    droppedBits[j] = exact ? 0 : CompressionToolbox::DroppedBits(tol);
+  }
+  CHECK(droppedBits[nField - 1] > 0);
+  CHECK(droppedBits[nField - 2] > 0);
+
+  std::vector<double> data(nPoint * nField);
+  for (auto i = 0ul; i < nPoint; ++i)
+    for (auto j = 0ul; j < nField; ++j) data[i * nField + j] = std::sin(0.37 * i + j) + 0.1 * j + 1e-7 * i;
+
+  std::vector<uint8_t> buffer;
+  CompressionToolbox::CompressBlock(data.data(), nPoint, nField, droppedBits.data(), buffer);
+  std::vector<double> result(data.size());
+  REQUIRE(CompressionToolbox::DecompressBlock(buffer.data(), buffer.size(), nPoint, nField, droppedBits.data(),
+                                              result.data()));
+
+  /*--- What is read on restart comes back bit for bit, the rest within the tolerance. ---*/
+  unsigned long nInexact = 0;
+  for (auto i = 0ul; i < nPoint; ++i) {
+    for (auto j = 0ul; j < nField; ++j) {
+      const double x = data[i * nField + j], y = result[i * nField + j];
+      if (droppedBits[j] == 0) {
+        CHECK(y == x);
+      } else {
+        CHECK(std::abs(y - x) <= tol * std::abs(x));
+        nInexact += (y != x);
+      }
+    }
+  }
+  CHECK(nInexact > 0);
+}